@@ -14,6 +14,7 @@
 #include <ctime>
 #include <locale>
 #include <exception>
+#include <algorithm>
 #include "calab.h"
 #include "PVItem.h"
 #include "globals.h"
@@ -161,6 +162,7 @@ PVItem& PVItem::operator=(const PVItem& other) {
         isPassive_.store(other.isPassive_.load());
         name_ = other.name_;
         nativeFieldType_.store(other.nativeFieldType_.load());
+        dbrCapacity_ = 0;
         numberOfValues_ = other.numberOfValues_;
         precCached_.store(other.precCached_.load());
         recordType_ = other.recordType_;
@@ -246,6 +248,7 @@ void PVItem::setNumberOfValues(uInt32 num) { numberOfValues_ = num; }
 void PVItem::setRecordType(const std::string& type) { recordType_ = type; }
 void PVItem::setDbr(void* newDbr) { // Get and replace the old buffer
     void* old = (void*)nativeFieldType_.exchange(newDbr);
+    dbrCapacity_ = 0;
     if (old) {
         free(old);
         old = nullptr;
@@ -253,8 +256,29 @@ void PVItem::setDbr(void* newDbr) { // Get and replace the old buffer
     updateChangeHash();
 }
 
+// Store a copy of `bytes` value bytes, reusing the current buffer when it is large enough.
+// Caller holds ioMutex. Returns false if a larger buffer could not be allocated.
+bool PVItem::assignDbr(const void* data, size_t bytes) {
+    void* current = nativeFieldType_.load();
+    if (current && dbrCapacity_ >= bytes) {
+        if (std::memcmp(current, data, bytes) != 0) {
+            std::memcpy(current, data, bytes);
+            dbrGeneration_.fetch_add(1);
+        }
+        updateChangeHash();
+        return true;
+    }
+    void* copy = malloc(bytes ? bytes : 1);
+    if (!copy) return false;
+    std::memcpy(copy, data, bytes);
+    setDbr(copy);
+    dbrCapacity_ = bytes ? bytes : 1;
+    return true;
+}
+
 void PVItem::clearDbr() {
     void* old = nativeFieldType_.exchange(nullptr);
+    dbrCapacity_ = 0;
     if (old) free(old);
     updateChangeHash();
 }
@@ -296,6 +320,10 @@ void PVItem::setConnected(bool connected) {
         isConnected_.store(connected);
         updateChangeHash();
     }
+    if (!connected) {
+        clearLastPut();
+        ctrlMetadataReceived_.store(false);
+    }
 }
 void PVItem::setHasValue(bool hasValue) {
     if (hasValue != hasValue_.load()) {
@@ -306,6 +334,7 @@ void PVItem::setHasValue(bool hasValue) {
 void PVItem::setPassive(bool passive) { isPassive_.store(passive); }
 void PVItem::setFields(const std::vector<std::pair<std::string, chanId>>& fields) { fields_ = fields; }
 void PVItem::setEnumValue(const dbr_ctrl_enum* src) {
+    enumStringsFromCache_.store(false);
     if (src) {
         std::memcpy(&enumValue, src, sizeof(dbr_ctrl_enum));
         enumStrings_.clear();
@@ -322,6 +351,137 @@ void PVItem::setEnumValue(const dbr_ctrl_enum* src) {
     }
 }
 
+void PVItem::setCachedEnumStrings(const std::vector<std::string>& strings) {
+    std::memset(&enumValue, 0, sizeof(dbr_ctrl_enum));
+    enumStrings_.clear();
+    const size_t count = std::min(strings.size(), static_cast<size_t>(MAX_ENUM_STATES));
+    enumValue.no_str = static_cast<dbr_short_t>(count);
+    for (size_t i = 0; i < count; ++i) {
+        const size_t len = std::min(strings[i].size(), static_cast<size_t>(MAX_ENUM_STRING_SIZE - 1));
+        std::memcpy(enumValue.strs[i], strings[i].data(), len);
+        enumStrings_.emplace_back(strings[i], 0, len);
+    }
+    enumStringsFromCache_.store(count > 0);
+}
+
+bool PVItem::addConnectWaiter(const std::shared_ptr<PvConnectLatch>& latch) {
+    std::lock_guard<std::mutex> lk(connectWaiters_mtx_);
+    if (isConnected_.load()) {
+        return false;
+    }
+    // Drop latches of calls that already gave up.
+    connectWaiters_.erase(std::remove_if(connectWaiters_.begin(), connectWaiters_.end(),
+        [](const std::weak_ptr<PvConnectLatch>& w) { return w.expired(); }), connectWaiters_.end());
+    connectWaiters_.push_back(latch);
+    return true;
+}
+
+void PVItem::releaseConnectWaiters() {
+    std::vector<std::weak_ptr<PvConnectLatch>> waiters;
+    {
+        std::lock_guard<std::mutex> lk(connectWaiters_mtx_);
+        waiters.swap(connectWaiters_);
+    }
+    for (auto& w : waiters) {
+        if (auto latch = w.lock()) latch->countDown();
+    }
+}
+
+void PVItem::clearLastPut() {
+    std::lock_guard<std::mutex> lk(lastPut_mtx_);
+    lastPut_.clear();
+    lastPutType_ = -1;
+    lastPutCount_ = 0;
+}
+
+bool PVItem::isLastPut(short dbrType, uInt32 count, const void* data, size_t size) const {
+    std::lock_guard<std::mutex> lk(lastPut_mtx_);
+    return lastPutType_ == dbrType && lastPutCount_ == count && lastPut_.size() == size
+        && (size == 0 || std::memcmp(lastPut_.data(), data, size) == 0);
+}
+
+void PVItem::setLastPut(short dbrType, uInt32 count, const void* data, size_t size) {
+    std::lock_guard<std::mutex> lk(lastPut_mtx_);
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    lastPut_.assign(bytes, bytes + size);
+    lastPutType_ = dbrType;
+    lastPutCount_ = count;
+}
+
+namespace {
+    const char* const kEnumStateFields[MAX_ENUM_STATES] = {
+        "ZRST", "ONST", "TWST", "THST", "FRST", "FVST", "SXST", "SVST",
+        "EIST", "NIST", "TEST", "ELST", "TVST", "TTST", "FTST", "FFST"
+    };
+
+    // Same representation the worker stores for numeric field channels.
+    std::string ctrlNumberToFieldString(double value) {
+        long longValue = static_cast<long>(value);
+        if (std::fabs(value - static_cast<double>(longValue)) < 0.0005 && std::fabs(value) < 32768.0) {
+            return std::to_string(longValue);
+        }
+        return std::to_string(value);
+    }
+}
+
+// Store DBR_CTRL_DOUBLE metadata as the field strings a per-field channel would deliver.
+void PVItem::setCtrlMetadata(const dbr_ctrl_double* ctrl) {
+    if (!ctrl) return;
+    const void* nul = std::memchr(ctrl->units, '\0', MAX_UNITS_SIZE);
+    const size_t unitLen = nul ? static_cast<const char*>(nul) - ctrl->units : static_cast<size_t>(MAX_UNITS_SIZE);
+    const std::pair<const char*, std::string> values[] = {
+        { "PREC", std::to_string(ctrl->precision) },
+        { "EGU",  std::string(ctrl->units, unitLen) },
+        { "HOPR", ctrlNumberToFieldString(ctrl->upper_disp_limit) },
+        { "LOPR", ctrlNumberToFieldString(ctrl->lower_disp_limit) },
+        { "HIHI", ctrlNumberToFieldString(ctrl->upper_alarm_limit) },
+        { "HIGH", ctrlNumberToFieldString(ctrl->upper_warning_limit) },
+        { "LOW",  ctrlNumberToFieldString(ctrl->lower_warning_limit) },
+        { "LOLO", ctrlNumberToFieldString(ctrl->lower_alarm_limit) },
+        { "DRVH", ctrlNumberToFieldString(ctrl->upper_ctrl_limit) },
+        { "DRVL", ctrlNumberToFieldString(ctrl->lower_ctrl_limit) },
+    };
+    std::vector<std::pair<std::string, chanId>> fields;
+    {
+        std::lock_guard<std::mutex> lk(io_mtx_);
+        fields = fields_;
+    }
+    for (const auto& field : fields) {
+        for (const auto& value : values) {
+            if (field.first == value.first) {
+                setFieldString(field.first, value.second);
+                break;
+            }
+        }
+    }
+    ctrlMetadataReceived_.store(true);
+}
+
+// Store DBR_CTRL_ENUM metadata: enum labels plus the requested ZRST..FFST field strings.
+void PVItem::setCtrlMetadata(const dbr_ctrl_enum* ctrl) {
+    if (!ctrl) return;
+    std::vector<std::pair<std::string, chanId>> fields;
+    {
+        std::lock_guard<std::mutex> lk(io_mtx_);
+        setEnumValue(ctrl);
+        fields = fields_;
+    }
+    for (const auto& field : fields) {
+        for (int i = 0; i < MAX_ENUM_STATES; ++i) {
+            if (field.first == kEnumStateFields[i]) {
+                std::string label;
+                if (i < ctrl->no_str) {
+                    const void* nul = std::memchr(ctrl->strs[i], '\0', MAX_ENUM_STRING_SIZE);
+                    label.assign(ctrl->strs[i], nul ? static_cast<const char*>(nul) - ctrl->strs[i] : static_cast<size_t>(MAX_ENUM_STRING_SIZE));
+                }
+                setFieldString(field.first, label);
+                break;
+            }
+        }
+    }
+    ctrlMetadataReceived_.store(true);
+}
+
 // Special method for CallbackContext
 void PVItem::setCallbackContext(std::atomic<int>* pendingCallbacks,
     std::condition_variable* cv,
@@ -337,6 +497,37 @@ void PVItem::setCallbackContext(std::atomic<int>* pendingCallbacks,
     */
 }
 
+// Register a PvIndexArray dirty set that wants to know when this PV changes.
+void PVItem::addChangeListener(const std::shared_ptr<PvDirtySet>& dirtySet, uint32_t index) {
+    if (!dirtySet) return;
+    std::lock_guard<std::mutex> lk(listener_mtx_);
+    // Drop listeners whose index array has been released.
+    changeListeners_.erase(
+        std::remove_if(changeListeners_.begin(), changeListeners_.end(),
+            [](const std::pair<std::weak_ptr<PvDirtySet>, uint32_t>& l) { return l.first.expired(); }),
+        changeListeners_.end());
+    changeListeners_.emplace_back(dirtySet, index);
+}
+
+void PVItem::notifyChangeListeners(bool errorChanged) {
+    std::lock_guard<std::mutex> lk(listener_mtx_);
+    for (size_t i = 0; i < changeListeners_.size();) {
+        std::shared_ptr<PvDirtySet> dirtySet = changeListeners_[i].first.lock();
+        if (!dirtySet) {
+            changeListeners_[i] = std::move(changeListeners_.back());
+            changeListeners_.pop_back();
+            continue;
+        }
+        if (errorChanged) {
+            dirtySet->markError(changeListeners_[i].second);
+        }
+        else {
+            dirtySet->mark(changeListeners_[i].second);
+        }
+        ++i;
+    }
+}
+
 std::string PVItem::info() const {
     std::ostringstream oss;
     oss << "  Name: " << name_ << "\n";
@@ -398,16 +589,20 @@ std::string PVItem::info() const {
 
 std::vector<std::string> PVItem::dbrValue2String() const {
     std::vector<std::string> result;
+    dbrValue2String(result);
+    return result;
+}
+
+void PVItem::dbrValue2String(std::vector<std::string>& result) const {
     const void* data = nativeFieldType_.load();
 
     const short dbrTypeLocal1 = dbrType_.load();
     if (!data || dbrTypeLocal1 < 0 || numberOfValues_ == 0) {
-        return result;
+        result.clear();
+        return;
     }
 
-    result.reserve(numberOfValues_);
-
-    // Handle different DBR types
+    // Elements are assigned in place so the caller's vector and strings keep their capacity.
     switch (dbrTypeLocal1) {
     case DBR_STRING:
     case DBR_TIME_STRING: {
@@ -415,49 +610,49 @@ std::vector<std::string> PVItem::dbrValue2String() const {
         if (dbrTypeLocal1 == DBR_TIME_STRING) {
             p += sizeof(epicsTimeStamp) + 2 * sizeof(dbr_short_t);
         }
+        result.resize(numberOfValues_);
         char buf[MAX_STRING_SIZE + 1];
         for (uInt32 i = 0; i < numberOfValues_; ++i) {
+            std::string& s = result[i];
             // Copy exactly MAX_STRING_SIZE bytes and null-terminate once
             std::memcpy(buf, p, MAX_STRING_SIZE);
             buf[MAX_STRING_SIZE] = '\0';
+            p += MAX_STRING_SIZE;
 
             // trim spaces
-            std::string s(buf);
-            size_t a = s.find_first_not_of(" \t\r\n");
-            size_t b = s.find_last_not_of(" \t\r\n");
-            s = (a == std::string::npos) ? std::string() : s.substr(a, b - a + 1);
+            const char* a = buf;
+            while (*a == ' ' || *a == '\t' || *a == '\r' || *a == '\n') ++a;
+            const char* b = a + std::strlen(a);
+            while (b > a && (b[-1] == ' ' || b[-1] == '\t' || b[-1] == '\r' || b[-1] == '\n')) --b;
+            s.assign(a, static_cast<size_t>(b - a));
 
             // Recognize special tokens (return as string)
             std::string u = s;
             for (auto& c : u) c = static_cast<char>(::toupper(static_cast<unsigned char>(c)));
             if (u == "INF" || u == "+INF" || u == "INFINITY" || u == "+INFINITY") {
-                result.emplace_back("INF");
+                s.assign("INF");
             }
             else if (u == "-INF" || u == "-INFINITY" || u == "_INF") {
-                result.emplace_back("-INF");
+                s.assign("-INF");
             }
             else if (u == "NAN") {
-                result.emplace_back("NAN");
+                s.assign("NAN");
             }
             else {
                 // Try to recognize numeric strings and format them using the locale
                 // Allows '.' or ',' as a decimal separator
-                std::string tmp = s;
-                for (char& ch : tmp) { if (ch == ',') ch = '.'; }
-                const char* cstr = tmp.c_str();
+                char tmp[MAX_STRING_SIZE + 1];
+                std::memcpy(tmp, s.c_str(), s.size() + 1);
+                for (char* c = tmp; *c; ++c) { if (*c == ',') *c = '.'; }
                 char* endp = nullptr;
                 errno = 0;
-                double val = std::strtod(cstr, &endp);
-                if (endp && *endp == '\0' && endp != cstr && errno != ERANGE) {
+                double val = std::strtod(tmp, &endp);
+                if (endp && *endp == '\0' && endp != tmp && errno != ERANGE) {
                     // Numeric string: format with locale (e.g., German -> comma)
-                    result.emplace_back(FormatUnit(val, std::string()));
-                }
-                else {
-                    // Non-numeric: take as is
-                    result.emplace_back(std::move(s));
+                    s = FormatUnit(val, std::string());
                 }
+                // Non-numeric: keep as is
             }
-            p += MAX_STRING_SIZE;
         }
         break;
     }
@@ -466,17 +661,16 @@ std::vector<std::string> PVItem::dbrValue2String() const {
     case DBR_TIME_ENUM: {
         // Map enum indices to their string labels when available
         auto idxs = dbrValue2Long();
-        if (result.capacity() < result.size() + idxs.size()) {
-            result.reserve(result.size() + idxs.size());
-        }
+        result.resize(idxs.size());
         const size_t nlabels = enumStrings_.size();
-        for (const long v : idxs) {
+        for (size_t i = 0; i < idxs.size(); ++i) {
+            const long v = idxs[i];
             if (v >= 0 && static_cast<size_t>(v) < nlabels && !enumStrings_[static_cast<size_t>(v)].empty()) {
-                result.emplace_back(enumStrings_[static_cast<size_t>(v)]);
+                result[i].assign(enumStrings_[static_cast<size_t>(v)]);
             }
             else {
                 // Fallback to numeric string if out of range or labels not available
-                result.emplace_back(std::to_string(v));
+                result[i] = std::to_string(v);
             }
         }
         break;
@@ -485,28 +679,39 @@ std::vector<std::string> PVItem::dbrValue2String() const {
     default: {
         // Format numeric types to string (FormatUnit handles INF/NAN)
         auto nums = dbrValue2Double();
-        if (result.capacity() < result.size() + nums.size()) {
-            result.reserve(result.size() + nums.size());
-        }
-        for (const double& v : nums) {
-            result.emplace_back(FormatUnit(v, std::string()));
+        result.resize(nums.size());
+        for (size_t i = 0; i < nums.size(); ++i) {
+            result[i] = FormatUnit(nums[i], std::string());
         }
         break;
     }
     }
-    return result;
 }
 
 std::vector<double> PVItem::dbrValue2Double() const {
-    std::vector<double> result;
+    std::vector<double> result(numberOfValues_);
+    result.resize(dbrValue2Double(result.data(), static_cast<uInt32>(result.size())));
+    return result;
+}
+
+namespace {
+    template<typename T>
+    inline void widenToDouble(const void* data, double* out, uInt32 count) {
+        const T* p = static_cast<const T*>(data);
+        for (uInt32 i = 0; i < count; ++i) {
+            *out++ = static_cast<double>(*p++);
+        }
+    }
+}
+
+uInt32 PVItem::dbrValue2Double(double* out, uInt32 maxCount) const {
     const void* data = nativeFieldType_.load();
 
     const short dbrTypeLocal = dbrType_.load();
-    if (!data || dbrTypeLocal < 0 || numberOfValues_ == 0) {
-        return result;
+    if (!out || !data || dbrTypeLocal < 0 || numberOfValues_ == 0) {
+        return 0;
     }
-
-    result.reserve(numberOfValues_);
+    const uInt32 count = std::min<uInt32>(numberOfValues_, maxCount);
 
     switch (dbrTypeLocal) {
     case DBR_STRING:
@@ -517,14 +722,14 @@ std::vector<double> PVItem::dbrValue2Double() const {
             p += sizeof(epicsTimeStamp) + 2 * sizeof(dbr_short_t);
         }
         char buf[MAX_STRING_SIZE + 1];
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
+        for (uInt32 i = 0; i < count; ++i) {
             // Copy exactly MAX_STRING_SIZE bytes and null-terminate once
             std::memcpy(buf, p, MAX_STRING_SIZE);
             buf[MAX_STRING_SIZE] = '\0';
             char* endp = nullptr;
             double val = std::strtod(buf, &endp);
             // If no conversion happened, fall back to 0.0
-            result.push_back(endp != buf ? val : 0.0);
+            out[i] = endp != buf ? val : 0.0;
             p += MAX_STRING_SIZE;
         }
     }
@@ -532,86 +737,39 @@ std::vector<double> PVItem::dbrValue2Double() const {
 
     case DBR_CHAR:
     case DBR_TIME_CHAR:
-    {
-        const dbr_char_t* p = static_cast<const dbr_char_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = static_cast<double>(*p++);
-        }
-    }
-    break;
+        widenToDouble<dbr_char_t>(data, out, count);
+        break;
 
     case DBR_SHORT:
     case DBR_TIME_SHORT:
-    {
-        const dbr_short_t* p = static_cast<const dbr_short_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = static_cast<double>(*p++);
-        }
-    }
-    break;
+        widenToDouble<dbr_short_t>(data, out, count);
+        break;
 
     case DBR_LONG:
     case DBR_TIME_LONG:
-    {
-        const dbr_long_t* p = static_cast<const dbr_long_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = static_cast<double>(*p++);
-        }
-    }
-    break;
+        widenToDouble<dbr_long_t>(data, out, count);
+        break;
 
     case DBR_FLOAT:
     case DBR_TIME_FLOAT:
-    {
-        const dbr_float_t* p = static_cast<const dbr_float_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = static_cast<double>(*p++);
-        }
-    }
-    break;
+        widenToDouble<dbr_float_t>(data, out, count);
+        break;
 
     case DBR_DOUBLE:
     case DBR_TIME_DOUBLE:
-    {
-        const dbr_double_t* p = static_cast<const dbr_double_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = *p++;
-        }
-    }
-    break;
+        std::memcpy(out, data, static_cast<size_t>(count) * sizeof(double));
+        break;
 
     case DBR_ENUM:
     case DBR_TIME_ENUM:
-    {
-        const dbr_enum_t* p = static_cast<const dbr_enum_t*>(data);
-        const size_t base = result.size();
-        result.resize(base + numberOfValues_);
-        double* out = result.data() + base;
-        for (uInt32 i = 0; i < numberOfValues_; ++i) {
-            *out++ = static_cast<double>(*p++);
-        }
-    }
-    break;
+        widenToDouble<dbr_enum_t>(data, out, count);
+        break;
 
     default:
         CaLabDbgPrintf("dbrValue2Double: Unknown DBR-type: %d", dbrTypeLocal);
+        return 0;
     }
-    return result;
+    return count;
 }
 
 std::vector<long> PVItem::dbrValue2Long() const {
@@ -1073,6 +1231,8 @@ void PVItem::setErrorCode(int code) {
     const int old = errorCode_.load(std::memory_order_relaxed);
     if (old == code) return;
     errorCode_.store(code, std::memory_order_relaxed);
+    // Let the index arrays refresh ErrorIO for this PV only.
+    notifyChangeListeners(true);
 
     // Determine whether we should be counted as an error (err > ECA_NORMAL)
     const bool wasErr = isErrorCounted_.load(std::memory_order_relaxed);
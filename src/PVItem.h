@@ -7,7 +7,9 @@
 #include <vector>
 #include <unordered_map>
 #include <mutex>
+#include <memory>
 #include <condition_variable>
+#include <chrono>
 #include <iomanip>
 #include "epics_compat.h"
 #include "calab.h"
@@ -20,6 +22,101 @@
 #define ECA_DISCONNCHID (ECA_NORMAL + 1)
 #endif
 
+/**
+ * @class PvDirtySet
+ * @brief Set of PvIndexArray indices whose PVItem changed since the last read.
+ *
+ * One instance is shared by all entries of a PvIndexArray. A PVItem marks its
+ * index whenever its change hash is updated, so getValue can take the changed
+ * indices directly instead of scanning every entry. Error code changes are
+ * tracked separately so ErrorIO is only refreshed where it changed. A new set
+ * starts with all indices marked so the first read examines the whole array.
+ * waitForChange blocks on the value set until it holds undrained marks.
+ */
+class PvDirtySet {
+public:
+    explicit PvDirtySet(uint32_t size) : values_(size), errors_(size) {}
+
+    // Mark an index whose value/metadata changed (duplicates are ignored).
+    void mark(uint32_t index) { values_.mark(index); }
+    // Mark an index whose error code changed (duplicates are ignored).
+    void markError(uint32_t index) { errors_.mark(index); }
+
+    // Take all marked indices and reset the respective set.
+    std::vector<uint32_t> drain() { return values_.drain(); }
+    std::vector<uint32_t> drainErrors() { return errors_.drain(); }
+
+    // Block until value indices are marked and not yet drained, or the timeout expires.
+    // Returns them without draining (getValue still sees them); returns at once if some are pending.
+    std::vector<uint32_t> waitPending(std::chrono::milliseconds timeout) { return values_.waitPending(timeout); }
+
+private:
+    struct IndexSet {
+        explicit IndexSet(uint32_t size) : marked(size, 1) {
+            indices.reserve(size);
+            for (uint32_t i = 0; i < size; ++i) indices.push_back(i);
+        }
+        void mark(uint32_t index) {
+            std::lock_guard<std::mutex> lk(mtx);
+            if (index >= marked.size()) return;
+            if (!marked[index]) {
+                marked[index] = 1;
+                indices.push_back(index);
+            }
+            if (waiters) cv.notify_all();
+        }
+        std::vector<uint32_t> drain() {
+            std::vector<uint32_t> out;
+            std::lock_guard<std::mutex> lk(mtx);
+            out.swap(indices);
+            for (uint32_t index : out) marked[index] = 0;
+            return out;
+        }
+        std::vector<uint32_t> waitPending(std::chrono::milliseconds timeout) {
+            std::unique_lock<std::mutex> lk(mtx);
+            ++waiters;
+            cv.wait_for(lk, timeout, [this] { return !indices.empty(); });
+            --waiters;
+            return indices;
+        }
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::vector<uint8_t> marked;
+        std::vector<uint32_t> indices;
+        uint32_t waiters = 0;
+    };
+    IndexSet values_;
+    IndexSet errors_;
+};
+
+/**
+ * @class PvConnectLatch
+ * @brief Countdown of channels a putValue call still waits for.
+ *
+ * Registered with each PVItem that is not yet connected; connectionChanged
+ * counts it down on CA_OP_CONN_UP, so the waiting call wakes as soon as its
+ * last channel connects instead of polling.
+ */
+class PvConnectLatch {
+public:
+    explicit PvConnectLatch(uint32_t count) : remaining_(count) {}
+
+    void countDown() {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (remaining_ > 0 && --remaining_ == 0) cv_.notify_all();
+    }
+    // Returns true once the count reached zero, false if the deadline passed first.
+    bool waitUntil(std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lk(mtx_);
+        return cv_.wait_until(lk, deadline, [this] { return remaining_ == 0; });
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint32_t remaining_;
+};
+
 /**
  * @class PVItem
  * @brief Represents a single Process Variable (PV) from EPICS.
@@ -78,10 +175,14 @@ public:
     bool tryGetFieldString_callerLocked(const std::string& fieldName, std::string& out) const;
 
     // Setters (alphabetically sorted by method name)
+    void addChangeListener(const std::shared_ptr<PvDirtySet>& dirtySet, uint32_t index);
     void setCallbackContext(std::atomic<int>* pendingCallbacks, std::condition_variable* cv, std::mutex* mtx, void* data = nullptr);
     void setConnected(bool connected);
     void setDbr(void* newDbr);
+    bool assignDbr(const void* data, size_t bytes); // copies into the current buffer when it is large enough
     void setDbrType(short type);
+    void setCtrlMetadata(const dbr_ctrl_double* ctrl);
+    void setCtrlMetadata(const dbr_ctrl_enum* ctrl);
     void setEnumValue(const dbr_ctrl_enum* enumValue);
     void setErrorCode(int code);
     void setFields(const std::vector<std::pair<std::string, chanId>>& fields);
@@ -103,8 +204,10 @@ public:
 
     // Conversion helpers (alphabetically sorted by method name)
     std::vector<double> dbrValue2Double() const;
+    uInt32 dbrValue2Double(double* out, uInt32 maxCount) const; // allocation-free, returns count written
     std::vector<long> dbrValue2Long() const;
     std::vector<std::string> dbrValue2String() const;
+    void dbrValue2String(std::vector<std::string>& out) const; // fills in place, reusing capacity
     std::string FormatUnit(double value, std::string unit) const;
     std::string getErrorAsString() const;
     std::string getSeverityAsString() const;
@@ -115,6 +218,23 @@ public:
     void clearEnumFetchRequested() { enumFetchRequested_.store(false); }
     bool tryMarkEnumFetchRequested() { bool expected = false; return enumFetchRequested_.compare_exchange_strong(expected, true); }
 
+    // Pipelined poll get coordination (CALAB_POLLING_PIPELINED): at most one get in flight per PV
+    void clearPollGetInFlight() { pollGetInFlight_.store(false); }
+    bool tryMarkPollGetInFlight() { bool expected = false; return pollGetInFlight_.compare_exchange_strong(expected, true); }
+    std::vector<unsigned char>& pollStage() { return pollStage_; } // guarded by ioMutex
+
+    // Static field coordination: fetched once per connection instead of monitored (alphabetically sorted)
+    void clearStaticFetchIssued() { staticFetchIssued_.store(false); }
+    bool isStaticField() const { return staticField_.load(); }
+    bool isStaticFetchIssued() const { return staticFetchIssued_.load(); }
+    void setStaticField(bool isStatic) { staticField_.store(isStatic); }
+    bool tryMarkStaticFetchIssued() { bool expected = false; return staticFetchIssued_.compare_exchange_strong(expected, true); }
+
+    // Control metadata coordination (CALAB_CTRL_METADATA): set when requested fields are served from DBR_CTRL
+    bool isCtrlMetadataWanted() const { return ctrlMetadataWanted_.load(); }
+    void setCtrlMetadataWanted() { ctrlMetadataWanted_.store(true); }
+    bool isCtrlMetadataReceived() const { return ctrlMetadataReceived_.load(); }
+
     // Hash functions for change detection
     std::size_t getChangeHash() const {
         return changeHash_.load();
@@ -126,6 +246,7 @@ public:
         const std::size_t stat = static_cast<std::size_t>(status_.load());
         const std::size_t sevr = static_cast<std::size_t>(severity_.load());
         const std::size_t ptr = reinterpret_cast<std::size_t>(nativeFieldType_.load());
+        const std::size_t gen = static_cast<std::size_t>(dbrGeneration_.load());
         // Mix fields using FNV-1a hash algorithm for a good distribution.
 #if UINTPTR_MAX == 0xffffffffu
         constexpr std::size_t kFNVOffset = 2166136261u;
@@ -140,7 +261,9 @@ public:
         h ^= stat;   h *= kFNVPrime;
         h ^= sevr;   h *= kFNVPrime;
         h ^= (ptr >> 4); h *= kFNVPrime; // Shift pointer to improve hash quality
+        h ^= gen;    h *= kFNVPrime;
         changeHash_.store(h);
+        notifyChangeListeners();
     }
 
     // Memory management
@@ -152,17 +275,65 @@ public:
     std::atomic<bool> toBeRemoved{ false };
     chanId channelId;
     evid eventId;
+    // DBE_PROPERTY subscription delivering DBR_CTRL metadata (CALAB_CTRL_METADATA).
+    evid propertyEventId = nullptr;
+
+    // Preconnect coordination: subscribe as soon as the channel comes up, without waiting for a read
+    bool isPrefetchWanted() const { return prefetchWanted_.load(); }
+    void setPrefetchWanted() { prefetchWanted_.store(true); }
+
+    // Persistent metadata cache (CALAB_METADATA_CACHE): enum labels loaded from disk until CA confirms them
+    bool hasCachedEnumStrings() const { return enumStringsFromCache_.load(); }
+    void setCachedEnumStrings(const std::vector<std::string>& strings);
+
+    // Connection waiters: false if already connected, otherwise the latch is counted down on connect
+    bool addConnectWaiter(const std::shared_ptr<PvConnectLatch>& latch);
+    void releaseConnectWaiters();
+
+    // Write suppression (CALAB_SUPPRESS_UNCHANGED_WRITES): payload of the last successful put
+    void clearLastPut();
+    bool isLastPut(short dbrType, uInt32 count, const void* data, size_t size) const;
+    void setLastPut(short dbrType, uInt32 count, const void* data, size_t size);
 
     // Other methods
     std::string info() const;
 
 private:
+    // Mark this PV's index in every registered PvDirtySet (value or error lane).
+    void notifyChangeListeners(bool errorChanged = false);
+
     // Member data
     std::atomic<std::size_t> changeHash_{ 0 };
+    // Index-array dirty sets interested in changes of this PV; guarded by listener_mtx_.
+    std::vector<std::pair<std::weak_ptr<PvDirtySet>, uint32_t>> changeListeners_;
     std::atomic<short> dbrType_;
     // Guard to avoid issuing duplicate enum metadata requests while one is pending.
     std::atomic<bool> enumFetchRequested_{ false };
+    // Set while a pipelined ca_array_get_callback for this PV is outstanding.
+    std::atomic<bool> pollGetInFlight_{ false };
+    // Value of the completed pipelined get until the worker applies it; reused across rounds. Guarded by io_mtx_.
+    std::vector<unsigned char> pollStage_;
+    // Field PV whose value practically never changes (DESC, EGU, RTYP, ...): one-shot get, no monitor.
+    std::atomic<bool> staticField_{ false };
+    // Set while the one-shot get of a static field is issued for the current connection.
+    std::atomic<bool> staticFetchIssued_{ false };
+    // Set once a requested field is served from the DBE_PROPERTY subscription.
+    std::atomic<bool> ctrlMetadataWanted_{ false };
+    // Set once a DBR_CTRL update arrived for the current connection; served fields are final even if empty.
+    std::atomic<bool> ctrlMetadataReceived_{ false };
+    // Set by preconnectPVs; connectionChanged subscribes the PV on connect.
+    std::atomic<bool> prefetchWanted_{ false };
+    // Set while enumStrings_ come from the on-disk metadata cache and have not been re-read from CA.
+    std::atomic<bool> enumStringsFromCache_{ false };
     std::vector<std::string> enumStrings_;
+    // Last payload written by putValue; cleared on disconnect and failed puts. Guarded by lastPut_mtx_.
+    std::vector<unsigned char> lastPut_;
+    short lastPutType_ = -1;
+    uInt32 lastPutCount_ = 0;
+    mutable std::mutex lastPut_mtx_;
+    // Latches of putValue calls waiting for this channel to connect; guarded by connectWaiters_mtx_.
+    std::vector<std::weak_ptr<PvConnectLatch>> connectWaiters_;
+    std::mutex connectWaiters_mtx_;
     dbr_ctrl_enum enumValue;
     // Last EPICS CA error/status code associated with this PV (ECA_*).
     // Defaults to a disconnect state until the first successful connection/value.
@@ -176,8 +347,13 @@ private:
     // Tracks whether this PV currently contributes to the global PV error count.
     std::atomic<bool> isErrorCounted_{ false };
     std::atomic<bool> isPassive_;
+    mutable std::mutex listener_mtx_;
     std::string name_;
     std::atomic<void*> nativeFieldType_{ nullptr };
+    // Allocated size of nativeFieldType_ when known (assignDbr), 0 otherwise.
+    size_t dbrCapacity_ = 0;
+    // Bumped when assignDbr rewrites the buffer in place, since the pointer then stays the same.
+    std::atomic<uint32_t> dbrGeneration_{ 0 };
     uInt32 numberOfValues_;
     // Cached precision from the PREC field (-1 = not set/unknown). Accessed lock-free.
     std::atomic<int> precCached_{ -1 };
@@ -35,15 +35,22 @@
 #include <mutex>
 #include <condition_variable>
 #include <deque>
+#include <map>
 #include <atomic>
 #include <cstdint>
 #include <cmath>
 #include <limits>
 #include <cstring>
 #include <cstdio>
+#include <functional>
+#include <fstream>
+#include <type_traits>
+#include <charconv>
+#include <system_error>
 #include "calab.h"
 #include "TimeoutUniqueLock.h"
 #include "globals.h"
+#include "numericParse.h"
 #include <cinttypes>
 #if defined _WIN32 || defined _WIN64
 #include <alarm.h>
@@ -93,13 +100,14 @@ namespace {
 
 static_assert(sizeof(uintptr_t) == sizeof(void*), "calab: uintptr_t must be same size as void* (pointer-sized integer required)");
 using atomic_ptr_t = std::atomic<uintptr_t>;
-static bool try_schedule_deletion(PvIndexEntry* entry);
-static void mark_deletion_done(PvIndexEntry* entry) noexcept;
+static bool try_schedule_deletion(uintptr_t token);
+static void mark_deletion_done(uintptr_t token) noexcept;
 
 // Attempt to atomically load the array slot and acquire a usage-ref for the entry.
 // Guarantees that the returned entry was still the current element when acquired.
 // If the slot is empty or acquisition fails, returns nullptr.
-// Note: eltPtr must point to the array element storage (interpreted as atomic_ptr_t).
+// Note: eltPtr must point to the array element storage (interpreted as atomic_ptr_t
+// holding a PvEntrySlots token).
 static PvIndexEntry* acquireEntryFromElt(void* eltPtr) noexcept {
 	if (!eltPtr) return nullptr;
 	auto atomicElt = reinterpret_cast<atomic_ptr_t*>(eltPtr);
@@ -108,28 +116,26 @@ static PvIndexEntry* acquireEntryFromElt(void* eltPtr) noexcept {
 		uintptr_t raw = atomicElt->load(std::memory_order_acquire);
 		if (!raw) return nullptr;
 
-		PvIndexEntry* entry = reinterpret_cast<PvIndexEntry*>(raw);
-		if (!entry) return nullptr;
-
-		{
-			if (!isLiveEntry(entry)) {
-				uintptr_t expected = raw;
-				(void)atomicElt->compare_exchange_strong(
-					expected, 0, std::memory_order_acq_rel, std::memory_order_acquire);
-				return nullptr;
-			}
+		if (!PvEntrySlots::liveSlot(raw)) {
+			// Stale token: the entry was deleted, clear the element.
+			uintptr_t expected = raw;
+			(void)atomicElt->compare_exchange_strong(
+				expected, 0, std::memory_order_acq_rel, std::memory_order_acquire);
+			return nullptr;
+		}
 
-			if (!entry->try_acquire()) {
-				return nullptr;
-			}
+		if (!PvEntrySlots::tryAcquire(raw)) {
+			return nullptr;
 		}
 
+		PvIndexEntry* entry = PvEntrySlots::lookup(raw);
 		uintptr_t now = atomicElt->load(std::memory_order_acquire);
-		if (now == raw) {
+		if (entry && now == raw) {
 			return entry;
 		}
 
-		entry->release();
+		PvEntrySlots::releaseRef(raw);
+		if (!entry) return nullptr;
 	}
 }
 
@@ -140,16 +146,18 @@ static void releaseEntry(PvIndexEntry* entry) noexcept {
 	entry->release();
 }
 
-static bool tryReclaimAndDelete(PvIndexEntry* entry,
+static bool tryReclaimAndDelete(uintptr_t token,
 	std::chrono::seconds hardTimeout = std::chrono::seconds(30)) noexcept {
-	if (!entry) return true;
+	if (!token) return true;
 
-	if (!try_schedule_deletion(entry)) {
+	if (!try_schedule_deletion(token)) {
 		return true;
 	}
 
-	if (!isLiveEntry(entry)) {
-		mark_deletion_done(entry);
+	// Resolve only after owning the deletion token; a stale token means it is already gone.
+	PvIndexEntry* entry = PvEntrySlots::lookup(token);
+	if (!entry) {
+		mark_deletion_done(token);
 		return true;
 	}
 
@@ -164,7 +172,7 @@ static bool tryReclaimAndDelete(PvIndexEntry* entry,
 			g.waitForNotification(std::chrono::milliseconds(20));
 
 			if (std::chrono::steady_clock::now() - start > hardTimeout) {
-				mark_deletion_done(entry);
+				mark_deletion_done(token);
 				return false;
 			}
 		}
@@ -173,7 +181,7 @@ static bool tryReclaimAndDelete(PvIndexEntry* entry,
 		if (entry->current_refs() != 0) {
 			CaLabDbgPrintf("tryReclaimAndDelete: immediate-delete requested but refs=%u for %p",
 				entry->current_refs(), static_cast<void*>(entry));
-			mark_deletion_done(entry);
+			mark_deletion_done(token);
 			return false;
 		}
 	}
@@ -181,21 +189,8 @@ static bool tryReclaimAndDelete(PvIndexEntry* entry,
 	if (entry->metaInfo) { delete entry->metaInfo; entry->metaInfo = nullptr; }
 	entry->pvItem = nullptr;
 
-#if defined(_MSC_VER)
-#	include <crtdbg.h>
-	if (_CrtIsValidHeapPointer(entry)) {
-		mark_deletion_done(entry);
-		delete entry;
-	}
-	else {
-		CaLabDbgPrintf("tryReclaimAndDelete: entry %p invalid at deletion time; skipping delete",
-			static_cast<void*>(entry));
-		mark_deletion_done(entry);
-	}
-#else
-	mark_deletion_done(entry);
+	mark_deletion_done(token);
 	delete entry;
-#endif
 
 	return true;
 }
@@ -234,21 +229,32 @@ struct PvEntryHandle {
 	PvIndexEntry* operator->() const noexcept { return entry; }
 	PvIndexEntry& operator*() const noexcept { return *entry; }
 };
-// Deletion scheduler to avoid double-delete races when same entry pointer appears in multiple arrays.
+// Returns the dirty set shared by the entries of an index array (nullptr if no entry is live).
+static std::shared_ptr<PvDirtySet> findDirtySet(sLongArrayHdl* arr) noexcept {
+	if (!arr || !*arr || !**arr) return nullptr;
+	const size_t count = (**arr)->dimSize;
+	for (size_t i = 0; i < count; ++i) {
+		PvEntryHandle entry{ arr, i };
+		if (entry && entry->dirtySet) return entry->dirtySet;
+	}
+	return nullptr;
+}
+
+// Deletion scheduler to avoid double-delete races when same entry token appears in multiple arrays.
 static std::mutex g_deletionMutex;
-static std::unordered_set<PvIndexEntry*> g_deletionScheduled;
+static std::unordered_set<uintptr_t> g_deletionScheduled;
 
-static bool try_schedule_deletion(PvIndexEntry* entry) {
-	if (!entry) return false;
+static bool try_schedule_deletion(uintptr_t token) {
+	if (!token) return false;
 	std::lock_guard<std::mutex> lk(g_deletionMutex);
-	auto res = g_deletionScheduled.insert(entry);
+	auto res = g_deletionScheduled.insert(token);
 	return res.second; // true if inserted (we are owner), false if already scheduled
 }
 
-static void mark_deletion_done(PvIndexEntry* entry) noexcept {
-	if (!entry) return;
+static void mark_deletion_done(uintptr_t token) noexcept {
+	if (!token) return;
 	std::lock_guard<std::mutex> lk(g_deletionMutex);
-	g_deletionScheduled.erase(entry);
+	g_deletionScheduled.erase(token);
 }
 
 static inline void sanitizePvIndexArray(sLongArray* arr, size_t dim) noexcept {
@@ -263,12 +269,12 @@ static inline void sanitizePvIndexArray(sLongArray* arr, size_t dim) noexcept {
 #endif
 }
 
-static void deferredDeletionWorker(std::vector<PvIndexEntry*> entries) {
+static void deferredDeletionWorker(std::vector<uintptr_t> tokens) {
 	const auto hardTimeout = std::chrono::seconds(60);
-	for (PvIndexEntry* entry : entries) {
-		if (!entry) continue;
-		if (!tryReclaimAndDelete(entry, hardTimeout)) {
-			CaLabDbgPrintf("deferredDeletionWorker: could not reclaim %p within timeout; skipping for now.", static_cast<void*>(entry));
+	for (uintptr_t token : tokens) {
+		if (!token) continue;
+		if (!tryReclaimAndDelete(token, hardTimeout)) {
+			CaLabDbgPrintf("deferredDeletionWorker: could not reclaim token 0x%" PRIxPTR " within timeout; skipping for now.", token);
 		}
 	}
 }
@@ -284,16 +290,20 @@ static inline bool tryClaimAndDeletePvIndexEntry(void* eltPtr) {
 		return false;
 	}
 
-	PvIndexEntry* entry = reinterpret_cast<PvIndexEntry*>(raw);
-	if (!entry) return false;
-
 	// Try to become the canonical deleter for this entry.
-	if (!try_schedule_deletion(entry)) {
-		CaLabDbgPrintf("tryClaimAndDeletePvIndexEntry: deletion already scheduled for %p -> skipping", static_cast<void*>(entry));
+	if (!try_schedule_deletion(raw)) {
+		CaLabDbgPrintf("tryClaimAndDeletePvIndexEntry: deletion already scheduled for token 0x%" PRIxPTR " -> skipping", raw);
 		// Slot cleared by us; another path will perform (or has performed) deletion.
 		return true;
 	}
 
+	PvIndexEntry* entry = PvEntrySlots::lookup(raw);
+	if (!entry) {
+		// Stale token; the entry has already been deleted.
+		mark_deletion_done(raw);
+		return true;
+	}
+
 	// Prevent further acquirers
 	entry->mark_deleting();
 
@@ -306,19 +316,6 @@ static inline bool tryClaimAndDeletePvIndexEntry(void* eltPtr) {
 		ca_pend_event(0.001);
 		g.waitForNotification(std::chrono::milliseconds(20));
 
-		// Log and break-to-defer on suspiciously large refcounts (defensive)
-		const unsigned refs = entry->current_refs();
-		if (refs > (1u << 24)) {
-			CaLabDbgPrintf("tryClaimAndDeletePvIndexEntry: suspicious refcount %u for %p during delete; deferring.", refs, static_cast<void*>(entry));
-			// schedule deferred deletion by spawning worker with single entry
-			std::vector<PvIndexEntry*> v;
-			v.push_back(entry);
-			std::thread(deferredDeletionWorker, std::move(v)).detach();
-			// We already own deletion token but deferredDeletionWorker will call tryReclaimAndDelete (which uses the token logic)
-			mark_deletion_done(entry);
-			return true;
-		}
-
 		if (std::chrono::steady_clock::now() - start > hardTimeout) {
 			CaLabDbgPrintf("tryClaimAndDeletePvIndexEntry: timeout waiting for refs to drop (%u remain). Proceeding with caution.", entry->current_refs());
 			std::this_thread::sleep_for(std::chrono::milliseconds(100));
@@ -331,7 +328,7 @@ static inline bool tryClaimAndDeletePvIndexEntry(void* eltPtr) {
 		entry->metaInfo = nullptr;
 	}
 	entry->pvItem = nullptr;
-	mark_deletion_done(entry);
+	mark_deletion_done(raw);
 	delete entry;
 
 	return true;
@@ -375,8 +372,23 @@ namespace {
 		uint16_t severity = 0;
 		size_t dataBytes = 0;
 		void* dataCopy = nullptr; // Ownership is transferred to PVItem; freed here on failure.
+		bool pollStaged = false; // Pipelined poll get: dataBytes wait in PVItem::pollStage().
 	};
 
+	// Size of one value element of a plain or DBR_TIME type (0 for other types).
+	size_t dbrValueElementSize(long type) {
+		switch (type) {
+		case DBR_CHAR:    case DBR_TIME_CHAR:    return sizeof(dbr_char_t);
+		case DBR_SHORT:   case DBR_TIME_SHORT:   return sizeof(dbr_short_t);
+		case DBR_LONG:    case DBR_TIME_LONG:    return sizeof(dbr_long_t);
+		case DBR_FLOAT:   case DBR_TIME_FLOAT:   return sizeof(dbr_float_t);
+		case DBR_DOUBLE:  case DBR_TIME_DOUBLE:  return sizeof(dbr_double_t);
+		case DBR_ENUM:    case DBR_TIME_ENUM:    return sizeof(dbr_enum_t);
+		case DBR_STRING:  case DBR_TIME_STRING:  return MAX_STRING_SIZE;
+		default:                                 return 0;
+		}
+	}
+
 	// Globals for the value-changed worker queue.
 	std::mutex g_vcMutex;
 	std::condition_variable g_vcCv;
@@ -398,6 +410,88 @@ namespace {
 		g_vcStarted.store(false);
 	}
 
+	// A freshly applied value of an .RTYP or field PV updates its parent: the record type,
+	// or the field string served with the parent's outputs.
+	void applyValueToParent(PVItem* pvItem, const std::string& pvName) {
+		// If this is an .RTYP PV, update the parent's record type.
+		const bool isRtypeString = pvName.size() >= 5 && pvName.compare(pvName.size() - 5, 5, ".RTYP") == 0;
+		if (isRtypeString) {
+			PVItem* parentPvItem = nullptr;
+			{
+				// No need to lock the registry; the parent pointer is on the pvItem itself.
+				std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+				parentPvItem = pvItem->parent;
+			}
+			if (parentPvItem) {
+				std::string recordType;
+				{
+					// Derive recordType from the freshly set value.
+					std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+					auto values = pvItem->dbrValue2String();
+					if (!values.empty()) recordType = values[0];
+				}
+				if (!recordType.empty()) {
+					TimeoutUniqueLock<std::mutex> parentLock(
+						parentPvItem->ioMutex(),
+						"valueChanged-parent-worker",
+						std::chrono::milliseconds(200)
+					);
+					if (parentLock.isLocked()) {
+						pvItem->parent->setRecordType(recordType);
+					}
+					else {
+						CaLabDbgPrintf("Error: Failed to acquire unique lock for parent of %s in worker (RTYP).", pvName.c_str());
+					}
+					Globals::getInstance().cacheRecordType(parentPvItem->getName(), recordType);
+				}
+			}
+		}
+
+		// If this is a field PV (e.g., 'base.FIELD' but not '.RTYP'), store its string value on the parent.
+		{
+			// Fast check: contains a dot and does not end with .RTYP.
+			const size_t dotPos = pvName.find('.');
+			if (dotPos != std::string::npos && !isRtypeString) {
+				PVItem* parentPvItem = nullptr;
+				{
+					std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+					parentPvItem = pvItem->parent;
+				}
+				if (parentPvItem) {
+					// Extract field name and its most recent string value.
+					const std::string fieldName = pvName.substr(dotPos + 1);
+					std::string fieldString;
+					{
+						std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+						// Use string conversion for strings/enums, and numeric->string otherwise.
+						auto strValues = pvItem->dbrValue2String();
+						if (!strValues.empty()) {
+							fieldString = strValues[0];
+						}
+						else {
+							auto numValues = pvItem->dbrValue2Double();
+							if (!numValues.empty()) {
+								// Store numeric field as a plain integer-like string if it's close to an integer.
+								double value = numValues[0];
+								long longValue = static_cast<long>(value);
+								if (std::fabs(value - static_cast<double>(longValue)) < 0.0005 && std::fabs(value) < 32768.0) {
+									fieldString = std::to_string(longValue);
+								}
+								else {
+									fieldString = std::to_string(value);
+								}
+							}
+						}
+					}
+					if (!fieldName.empty() && !fieldString.empty()) {
+						// `setFieldString` performs its own locking; avoid double-locking the same mutex.
+						parentPvItem->setFieldString(fieldName, fieldString);
+					}
+				}
+			}
+		}
+	}
+
 	// Processes a single value change task from the queue.
 	void processValueChangeTask(ValueChangeTask& task) {
 		Globals& g = Globals::getInstance();
@@ -445,6 +539,8 @@ namespace {
 			);
 			if (!itemLock.isLocked()) {
 				CaLabDbgPrintf("Error: Failed to acquire unique lock for %s in worker (item).", task.pvName.c_str());
+				if (task.pollStaged) pvItem->clearPollGetInFlight(); // let the next round retry
+				pvItem->clearStaticFetchIssued(); // a lost one-shot value is fetched again
 				if (task.dataCopy) {
 					try {
 						free(task.dataCopy);
@@ -457,7 +553,8 @@ namespace {
 				return;
 			}
 
-			pvItem->setNumberOfValues(task.nElems);
+			// A failed poll get carries no count; keep the one the next get is issued with.
+			if (!task.pollStaged || task.dataBytes > 0) pvItem->setNumberOfValues(task.nElems);
 			pvItem->setErrorCode(task.errorCode);
 
 			if (task.hasTimeMeta) {
@@ -474,83 +571,21 @@ namespace {
 				task.dataCopy = nullptr; // Ownership moved.
 				pvItem->setHasValue(true);
 			}
-		}
-
-		// If this is an .RTYP PV, update the parent's record type.
-		const bool isRtypeString = task.pvName.size() >= 5 && task.pvName.compare(task.pvName.size() - 5, 5, ".RTYP") == 0;
-		if (isRtypeString) {
-			PVItem* parentPvItem = nullptr;
-			{
-				// No need to lock the registry; the parent pointer is on the pvItem itself.
-				std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-				parentPvItem = pvItem->parent;
-			}
-			if (parentPvItem) {
-				std::string recordType;
-				{
-					// Derive recordType from the freshly set value.
-					std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-					auto values = pvItem->dbrValue2String();
-					if (!values.empty()) recordType = values[0];
+			else if (task.pollStaged && task.dataBytes > 0) {
+				// Copied into the existing value buffer when it is large enough (no allocation per round).
+				if (pvItem->assignDbr(pvItem->pollStage().data(), task.dataBytes)) {
+					pvItem->setHasValue(true);
 				}
-				if (!recordType.empty()) {
-					TimeoutUniqueLock<std::mutex> parentLock(
-						parentPvItem->ioMutex(),
-						"valueChanged-parent-worker",
-						std::chrono::milliseconds(200)
-					);
-					if (parentLock.isLocked()) {
-						pvItem->parent->setRecordType(recordType);
-					}
-					else {
-						CaLabDbgPrintf("Error: Failed to acquire unique lock for parent of %s in worker (RTYP).", task.pvName.c_str());
-					}
+				else {
+					CaLabDbgPrintf("Worker: out of memory applying polled value of %s", task.pvName.c_str());
 				}
 			}
 		}
 
-		// If this is a field PV (e.g., 'base.FIELD' but not '.RTYP'), store its string value on the parent.
-		{
-			// Fast check: contains a dot and does not end with .RTYP.
-			const size_t dotPos = task.pvName.find('.');
-			if (dotPos != std::string::npos && !isRtypeString) {
-				PVItem* parentPvItem = nullptr;
-				{
-					std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-					parentPvItem = pvItem->parent;
-				}
-				if (parentPvItem) {
-					// Extract field name and its most recent string value.
-					const std::string fieldName = task.pvName.substr(dotPos + 1);
-					std::string fieldString;
-					{
-						std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-						// Use string conversion for strings/enums, and numeric->string otherwise.
-						auto strValues = pvItem->dbrValue2String();
-						if (!strValues.empty()) {
-							fieldString = strValues[0];
-						}
-						else {
-							auto numValues = pvItem->dbrValue2Double();
-							if (!numValues.empty()) {
-								// Store numeric field as a plain integer-like string if it's close to an integer.
-								double value = numValues[0];
-								long longValue = static_cast<long>(value);
-								if (std::fabs(value - static_cast<double>(longValue)) < 0.0005 && std::fabs(value) < 32768.0) {
-									fieldString = std::to_string(longValue);
-								}
-								else {
-									fieldString = std::to_string(value);
-								}
-							}
-						}
-					}
-					if (!fieldName.empty() && !fieldString.empty()) {
-						// `setFieldString` performs its own locking; avoid double-locking the same mutex.
-						parentPvItem->setFieldString(fieldName, fieldString);
-					}
-				}
-			}
+		applyValueToParent(pvItem, task.pvName);
+		if (task.pollStaged) {
+			// Only now may getPipelinedPollIndices reuse the stage for the next round.
+			pvItem->clearPollGetInFlight();
 		}
 
 		g.removePendingConnection(pvItem);
@@ -630,12 +665,72 @@ namespace {
 		g_vcCv.notify_one();
 	}
 
+	// One addEvent registration. Updates within the minimum interval after the last post are
+	// coalesced into `pending` and delivered by postDueEvents at the next allowed slot.
+	struct EventSubscription {
+		LVUserEventRef ref;
+		sResult* result;
+		std::chrono::steady_clock::duration minInterval{ 0 };
+		std::chrono::steady_clock::time_point lastPost{};
+		bool pending = false;
+	};
+
+	// A coalesced update queued for postDueEvents; identifies its subscription by PV, ref and result.
+	struct PendingEvent {
+		std::string pvName;
+		LVUserEventRef ref;
+		sResult* result;
+	};
+
 	// Manages LabVIEW User Event registrations for PVs.
 	struct EventRegistry {
 		std::mutex mtx;
-		std::unordered_map<std::string, std::vector<std::pair<LVUserEventRef, sResult*>>> map;
+		std::unordered_map<std::string, std::vector<EventSubscription>> map;
+		// Minimum interval set by setEventRate per RefNum; applied to later addEvent registrations too.
+		std::map<LVUserEventRef, std::chrono::steady_clock::duration> intervals;
+		// Subscriptions with a coalesced update waiting for their slot; lets the poll thread skip the scan.
+		std::atomic<uint32_t> pendingCount{ 0 };
+		// Pending subscriptions in the order they were coalesced; postDueEvents serves them first come,
+		// first served. Entries of subscriptions removed or served meanwhile are skipped.
+		std::deque<PendingEvent> pendingQueue;
+		// Token bucket enforcing CALAB_MAX_EVENT_RATE across all registrations (guarded by mtx).
+		double tokens = 0.0;
+		std::chrono::steady_clock::time_point tokensRefilled{};
 	} g_eventRegistry;
 
+	// Takes one token of the global CALAB_MAX_EVENT_RATE budget (caller holds g_eventRegistry.mtx).
+	// The bucket holds one second worth of events, so short bursts pass unthrottled.
+	bool takeEventToken(std::chrono::steady_clock::time_point now) {
+		const double maxRate = Globals::getInstance().maxEventRate;
+		if (maxRate <= 0.0) return true;
+		const double capacity = std::max(1.0, maxRate);
+		const double elapsed = std::chrono::duration<double>(now - g_eventRegistry.tokensRefilled).count();
+		g_eventRegistry.tokens = std::min(capacity, g_eventRegistry.tokens + elapsed * maxRate);
+		g_eventRegistry.tokensRefilled = now;
+		if (g_eventRegistry.tokens < 1.0) return false;
+		g_eventRegistry.tokens -= 1.0;
+		return true;
+	}
+
+	// Marks `sub` pending and queues it behind earlier pending subscriptions (caller holds
+	// g_eventRegistry.mtx). Only the first coalesced update counts; later ones just replace its state.
+	void markEventPending(const std::string& pvName, EventSubscription& sub) {
+		if (sub.pending) return;
+		sub.pending = true;
+		g_eventRegistry.pendingCount.fetch_add(1, std::memory_order_relaxed);
+		g_eventRegistry.pendingQueue.push_back({ pvName, sub.ref, sub.result });
+		Globals::getInstance().eventsCoalesced.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Removes the subscriptions of `ref` from `vec` (caller holds g_eventRegistry.mtx).
+	void eraseSubscriptions(std::vector<EventSubscription>& vec, LVUserEventRef ref) {
+		vec.erase(std::remove_if(vec.begin(), vec.end(), [&](const EventSubscription& sub) {
+			if (sub.ref != ref) return false;
+			if (sub.pending) g_eventRegistry.pendingCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+			}), vec.end());
+	}
+
 } // end anonymous namespace
 
 namespace {
@@ -865,7 +960,10 @@ extern "C" EXPORT void getValue(sStringArrayHdl* PvNameArray, sStringArrayHdl* F
 			}
 		}
 
-		if (*FieldNameArray && **FieldNameArray && (**FieldNameArray)->dimSize > 0 && (filter & out_filter::pviFieldValues || (filter & out_filter::pviFieldNames))) {
+		// Record types (.RTYP) are only resolved when fields are requested.
+		const bool hasFieldNames = FieldNameArray && *FieldNameArray && **FieldNameArray && (**FieldNameArray)->dimSize > 0;
+		const bool resolveRecordType = hasFieldNames || (filter & (out_filter::pviFieldNames | out_filter::pviFieldValues));
+		if (hasFieldNames && (filter & out_filter::pviFieldValues || (filter & out_filter::pviFieldNames))) {
 			for (uInt32 i = 0; i < nameCount; ++i) {
 				PvEntryHandle entry{ PvIndexArray, i };
 				if (!entry || !entry->pvItem) continue;
@@ -880,13 +978,13 @@ extern "C" EXPORT void getValue(sStringArrayHdl* PvNameArray, sStringArrayHdl* F
 				PvEntryHandle entry{ PvIndexArray, i };
 				if (entry && entry->pvItem) {
 					std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
-					if (entry->pvItem->channelId == nullptr || entry->pvItem->getRecordType().empty()) {
+					if (entry->pvItem->channelId == nullptr || (resolveRecordType && entry->pvItem->getRecordType().empty())) {
 						uninitializedPvNames.insert(entry->pvItem->getName());
 					}
 				}
 			}
 		}
-		subscribeBasePVs(uninitializedPvNames, Timeout, hardDeadline, NoMDEL);
+		subscribeBasePVs(uninitializedPvNames, Timeout, hardDeadline, NoMDEL, resolveRecordType);
 		connectPVs(uninitializedPvNames, Timeout, hardDeadline);
 		if (filter & out_filter::pviFieldValues) {
 			waitForUninitializedPvs(uninitializedPvNames, Timeout, hardDeadline);
@@ -1014,64 +1112,848 @@ extern "C" EXPORT void getValue(sStringArrayHdl* PvNameArray, sStringArrayHdl* F
 	}
 }
 
-extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall) {
-	if (PvIndexArray == nullptr || PvNameArray == nullptr || *PvNameArray == nullptr || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
-		if (CommunicationStatus) *CommunicationStatus = 1;
-		return;
-	}
+namespace {
+	// Common setup/teardown of the lean read exports (getValueDoubles, getValueMetadata).
+	// They share getValue's registry, subscriptions and dirty-set change tracking but skip
+	// instance resolution on every call and all string/result-cluster output.
+	struct LeanReadState {
+		uInt32 nameCount = 0;
+		LVBoolean noMDEL = 0;
+		bool needsReinit = false;
+		std::vector<uInt32> changedIndices;
+	};
 
-	Globals& g = Globals::getInstance();
-	if (g.stopped.load()) { if (CommunicationStatus) *CommunicationStatus = 1; return; }
+	bool beginLeanRead(const char* functionName, sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, double Timeout,
+		LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* IsInitialized, LeanReadState& st) {
+		Globals& g = Globals::getInstance();
+		st.noMDEL = g.bCaLabPolling ? 1 : 0;
+		st.nameCount = static_cast<uInt32>((**PvNameArray)->dimSize);
+		const std::chrono::steady_clock::time_point hardDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<long long>((Timeout > 0.0 ? Timeout : 0.0) * 1000.0));
+
+		st.needsReinit = st.noMDEL || *FirstCall || !*IsInitialized || !*PvIndexArray || !**PvIndexArray || (**PvIndexArray)->dimSize != st.nameCount;
+		if (st.needsReinit) {
+			std::unordered_set<std::string> uninitializedPvNames;
+			if (!setupPvIndexAndRegistry(PvNameArray, nullptr, PvIndexArray, CommunicationStatus, &uninitializedPvNames)) {
+				CaLabDbgPrintf("Error initializing %s.", functionName);
+				return false;
+			}
+			// Instance binding only matters for cleanup in unreserved; do it once per (re)initialization.
+			bindArraysToInstance(functionName, PvIndexArray, nullptr, nullptr, nullptr, nullptr);
 
-	// Ensure this thread is attached to the CA context while using CA APIs.
-	CaContextGuard _caThreadAttach;
+			for (uInt32 i = 0; i < st.nameCount; ++i) {
+				PvEntryHandle entry{ PvIndexArray, i };
+				if (entry && entry->pvItem) {
+					std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
+					if (entry->pvItem->channelId == nullptr) {
+						uninitializedPvNames.insert(entry->pvItem->getName());
+					}
+				}
+			}
+			// Lean reads take no field list, so record types are never resolved here.
+			subscribeBasePVs(uninitializedPvNames, Timeout, hardDeadline, &st.noMDEL, false);
+			*FirstCall = false;
+			*IsInitialized = true;
+		}
 
-	// Validate PV names.
-	if (!PvNameArray || !*PvNameArray || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
-		if (CommunicationStatus) *CommunicationStatus = 1;
-		return;
+		st.changedIndices = getChangedPvIndices(PvIndexArray, Timeout, hardDeadline, &st.noMDEL);
+		return true;
 	}
-	const uInt32 nameCount = static_cast<uInt32>((**PvNameArray)->dimSize);
-
-	// Determine which value array to use based on DataType.
-	const bool isString = (DataType == DT_STRING);
-	const bool isDouble = (DataType == DT_SINGLE || DataType == DT_DOUBLE);
-	const bool isChar = (DataType == DT_CHAR);
-	const bool isShort = (DataType == DT_SHORT);
-	const bool isLong32 = (DataType == DT_LONG);
-	const bool isQuad64 = (DataType == DT_QUAD);
-
-	// === Resolve instance binding early (similar to getValue) ===
-	MyInstanceData* instanceData = nullptr;
-	InstanceDataPtr* ownerPtr = nullptr;
-	{
-		std::lock_guard<std::mutex> instLock(g.instancesMutex);
 
-		// Try to find existing instance from array handles
-		if (PvIndexArray && *PvIndexArray) {
-			ownerPtr = g.getInstanceForArray(static_cast<void*>(*PvIndexArray));
+	void endLeanRead(sLongArrayHdl* PvIndexArray, const LeanReadState& st, LVBoolean* CommunicationStatus) {
+		if (Globals::getInstance().pvErrorCount.load(std::memory_order_relaxed) != 0) {
+			for (uInt32 i = 0; i < st.nameCount; ++i) {
+				PvEntryHandle entry{ PvIndexArray, i };
+				if (!entry || !entry->pvItem) continue;
+				if (entry->pvItem->getErrorCode() > (int)ECA_NORMAL) { *CommunicationStatus = 1; break; }
+			}
 		}
 
-		// Fallback: find a suitable instance
-		if (!ownerPtr && !g.instances.empty()) {
-			// Priority 1: Find an unused instance (no function name set yet)
-			for (auto it = g.instances.rbegin(); it != g.instances.rend(); ++it) {
-				if (*it && **it) {
-					MyInstanceData* candidate = static_cast<MyInstanceData*>(**it);
-					if (candidate && !candidate->isUnreserving.load(std::memory_order_acquire)
-						&& candidate->firstFunctionName.empty()) {
-						ownerPtr = *it;
-						break;
-					}
+		updatePvIndexArray(PvIndexArray, st.changedIndices);
+
+		if (st.noMDEL) {
+			for (uInt32 i = 0; i < st.nameCount; ++i) {
+				PvEntryHandle entry{ PvIndexArray, i };
+				if (entry && entry->pvItem && entry->pvItem->eventId) {
+					std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
+					ca_clear_subscription(entry->pvItem->eventId);
+					entry->pvItem->eventId = nullptr;
 				}
 			}
-			// Priority 2: Find an instance already assigned to putValue
-			if (!ownerPtr) {
-				for (auto it = g.instances.rbegin(); it != g.instances.rend(); ++it) {
-					if (*it && **it) {
-						MyInstanceData* candidate = static_cast<MyInstanceData*>(**it);
-						if (candidate && !candidate->isUnreserving.load(std::memory_order_acquire)
-							&& candidate->firstFunctionName == "putValue") {
+		}
+	}
+
+	// Resize a 1D numeric LabVIEW array to n elements; sets resized when the handle changed shape.
+	template<typename ArrayHdl>
+	MgErr resizeNumericArray1D(int32 typeCode, ArrayHdl* array, uInt32 n, bool& resized) {
+		if (!array) return noErr;
+		using DimSize = decltype((**array)->dimSize);
+		if (*array && **array && (**array)->dimSize == static_cast<DimSize>(n)) return noErr;
+		MgErr err = NumericArrayResize(typeCode, 1, (UHandle*)array, n);
+		if (err != noErr) return err;
+		(**array)->dimSize = static_cast<DimSize>(n);
+		resized = true;
+		return noErr;
+	}
+}
+
+extern "C" EXPORT void getValueDoubles(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, double Timeout, sDoubleArray2DHdl* DoubleValueArray, sShortArray2DHdl* AlarmArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* IsInitialized)
+{
+	if (PvIndexArray == nullptr || DoubleValueArray == nullptr || PvNameArray == nullptr || *PvNameArray == nullptr || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
+		*CommunicationStatus = 1;
+		return;
+	}
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) {
+		*CommunicationStatus = 1;
+		return;
+	}
+	CaContextGuard _caThreadAttach;
+	*CommunicationStatus = 0;
+
+	LeanReadState st;
+	if (!beginLeanRead("getValueDoubles", PvNameArray, PvIndexArray, Timeout, CommunicationStatus, FirstCall, IsInitialized, st)) {
+		return;
+	}
+	const uInt32 nameCount = st.nameCount;
+	if (!st.changedIndices.empty() || st.needsReinit) {
+		TimeoutUniqueLock<std::shared_timed_mutex> getLockGuard(g.getLock, "getValueDoubles");
+		if (!getLockGuard.isLocked()) {
+			CaLabDbgPrintf("Warning: Could not acquire an exclusive lock for getValueDoubles");
+			*CommunicationStatus = 1;
+			return;
+		}
+		TimeoutSharedLock<std::shared_timed_mutex> rlock(g.pvRegistryLock, "getValueDoubles", std::chrono::milliseconds(30000));
+		if (!rlock.isLocked()) {
+			CaLabDbgPrintf("Error: Failed to acquire shared lock for getValueDoubles.");
+			*CommunicationStatus = 1;
+			return;
+		}
+
+		// Keep the column count of an existing output array (same rule as getValue).
+		uInt32 maxNumberOfValues = 0;
+		if (*DoubleValueArray && **DoubleValueArray && (**DoubleValueArray)->dimSizes[0] == nameCount) {
+			maxNumberOfValues = (**DoubleValueArray)->dimSizes[1];
+		}
+		if (!maxNumberOfValues) {
+			for (uInt32 i = 0; i < nameCount; ++i) {
+				PvEntryHandle entry{ PvIndexArray, i };
+				if (!entry || !entry->pvItem) continue;
+				std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
+				maxNumberOfValues = std::max(maxNumberOfValues, entry->pvItem->getNumberOfValues());
+			}
+		}
+
+		bool fullRefresh = st.needsReinit;
+		if (!*DoubleValueArray || !**DoubleValueArray ||
+			(**DoubleValueArray)->dimSizes[0] != nameCount ||
+			(**DoubleValueArray)->dimSizes[1] != maxNumberOfValues) {
+			MgErr err = NumericArrayResize(fD, 2, (UHandle*)DoubleValueArray, static_cast<size_t>(nameCount) * static_cast<size_t>(maxNumberOfValues));
+			if (err != noErr) {
+				CaLabDbgPrintf("Error preparing output arrays: %d", err);
+				*CommunicationStatus = 1;
+				return;
+			}
+			(**DoubleValueArray)->dimSizes[0] = nameCount;
+			(**DoubleValueArray)->dimSizes[1] = maxNumberOfValues;
+			fullRefresh = true;
+		}
+		if (AlarmArray && (!*AlarmArray || !**AlarmArray ||
+			(**AlarmArray)->dimSizes[0] != nameCount || (**AlarmArray)->dimSizes[1] != 2)) {
+			MgErr err = NumericArrayResize(iW, 2, (UHandle*)AlarmArray, static_cast<size_t>(nameCount) * 2);
+			if (err != noErr) {
+				CaLabDbgPrintf("Error preparing output arrays: %d", err);
+				*CommunicationStatus = 1;
+				return;
+			}
+			(**AlarmArray)->dimSizes[0] = nameCount;
+			(**AlarmArray)->dimSizes[1] = 2;
+			fullRefresh = true;
+		}
+
+		// Convert straight from the DBR buffer into the LabVIEW row; no per-PV allocations.
+		const uInt32 cols = maxNumberOfValues;
+		double* values = (**DoubleValueArray)->elt;
+		int16_t* alarms = (AlarmArray && *AlarmArray) ? (**AlarmArray)->elt : nullptr;
+		auto writeRow = [&](uInt32 idx) {
+			if (idx >= nameCount) return;
+			double* row = values + static_cast<size_t>(idx) * cols;
+			uInt32 copied = 0;
+			int16_t status = epicsAlarmComm;
+			int16_t severity = epicsSevInvalid;
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (entry && entry->pvItem) {
+				std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
+				copied = entry->pvItem->dbrValue2Double(row, cols);
+				status = entry->pvItem->getStatus();
+				severity = entry->pvItem->getSeverity();
+			}
+			// Clear remaining columns in this row to avoid stale data
+			for (uInt32 j = copied; j < cols; ++j) {
+				row[j] = 0.0;
+			}
+			if (alarms) {
+				alarms[static_cast<size_t>(idx) * 2] = status;
+				alarms[static_cast<size_t>(idx) * 2 + 1] = severity;
+			}
+		};
+		if (fullRefresh || st.changedIndices.empty()) {
+			for (uInt32 i = 0; i < nameCount; ++i) writeRow(i);
+		}
+		else {
+			for (uInt32 idx : st.changedIndices) writeRow(idx);
+		}
+	}
+
+	endLeanRead(PvIndexArray, st, CommunicationStatus);
+}
+
+extern "C" EXPORT void getValueMetadata(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, double Timeout, sUInt32ArrayHdl* Seconds, sUInt32ArrayHdl* Nanoseconds, sShortArrayHdl* Status, sShortArrayHdl* Severity, sUInt32ArrayHdl* ErrorCode, sBooleanArrayHdl* Connected, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* IsInitialized)
+{
+	if (PvIndexArray == nullptr || PvNameArray == nullptr || *PvNameArray == nullptr || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
+		*CommunicationStatus = 1;
+		return;
+	}
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) {
+		*CommunicationStatus = 1;
+		return;
+	}
+	CaContextGuard _caThreadAttach;
+	*CommunicationStatus = 0;
+
+	LeanReadState st;
+	if (!beginLeanRead("getValueMetadata", PvNameArray, PvIndexArray, Timeout, CommunicationStatus, FirstCall, IsInitialized, st)) {
+		return;
+	}
+	const uInt32 nameCount = st.nameCount;
+
+	// Error code changes are tracked on their own lane of the dirty set. It is only taken when
+	// ErrorCode is wired, and put back if the columns cannot be written, so getValue on the same
+	// index array still sees the changes.
+	std::vector<uInt32> errorIndices;
+	std::shared_ptr<PvDirtySet> errorSet = ErrorCode ? findDirtySet(PvIndexArray) : nullptr;
+	if (errorSet) {
+		errorIndices = errorSet->drainErrors();
+	}
+	auto restoreErrorMarks = [&] {
+		for (uInt32 idx : errorIndices) errorSet->markError(idx);
+	};
+
+	if (!st.changedIndices.empty() || !errorIndices.empty() || st.needsReinit) {
+		TimeoutSharedLock<std::shared_timed_mutex> rlock(g.pvRegistryLock, "getValueMetadata", std::chrono::milliseconds(30000));
+		if (!rlock.isLocked()) {
+			CaLabDbgPrintf("Error: Failed to acquire shared lock for getValueMetadata.");
+			restoreErrorMarks();
+			*CommunicationStatus = 1;
+			return;
+		}
+
+		bool fullRefresh = st.needsReinit;
+		MgErr err = noErr;
+		err += resizeNumericArray1D(uL, Seconds, nameCount, fullRefresh);
+		err += resizeNumericArray1D(uL, Nanoseconds, nameCount, fullRefresh);
+		err += resizeNumericArray1D(iW, Status, nameCount, fullRefresh);
+		err += resizeNumericArray1D(iW, Severity, nameCount, fullRefresh);
+		err += resizeNumericArray1D(uL, ErrorCode, nameCount, fullRefresh);
+		err += resizeNumericArray1D(uB, Connected, nameCount, fullRefresh);
+		if (err != noErr) {
+			CaLabDbgPrintf("Error preparing output arrays: %d", err);
+			restoreErrorMarks();
+			*CommunicationStatus = 1;
+			return;
+		}
+
+		// Plain element pointers into each column; null when the caller did not wire it.
+		uInt32* secOut = (Seconds && *Seconds) ? (**Seconds)->elt : nullptr;
+		uInt32* nsecOut = (Nanoseconds && *Nanoseconds) ? (**Nanoseconds)->elt : nullptr;
+		int16_t* statOut = (Status && *Status) ? (**Status)->elt : nullptr;
+		int16_t* sevrOut = (Severity && *Severity) ? (**Severity)->elt : nullptr;
+		uInt32* errOut = (ErrorCode && *ErrorCode) ? (**ErrorCode)->elt : nullptr;
+		LVBoolean* connOut = (Connected && *Connected) ? (**Connected)->elt : nullptr;
+
+		auto writeIndex = [&](uInt32 idx) {
+			if (idx >= nameCount) return;
+			uInt32 sec = 0, nsec = 0, lvCode = 0;
+			int16_t status = epicsAlarmComm;
+			int16_t severity = epicsSevInvalid;
+			bool connected = false;
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (entry && entry->pvItem) {
+				std::lock_guard<std::mutex> lock(entry->pvItem->ioMutex());
+				sec = entry->pvItem->getTimestamp();
+				nsec = entry->pvItem->getTimestampNSec();
+				status = entry->pvItem->getStatus();
+				severity = entry->pvItem->getSeverity();
+				connected = entry->pvItem->isConnected();
+				const int caErr = entry->pvItem->getErrorCode();
+				lvCode = (caErr <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(caErr) + ERROR_OFFSET;
+			}
+			if (secOut) secOut[idx] = sec;
+			if (nsecOut) nsecOut[idx] = nsec;
+			if (statOut) statOut[idx] = status;
+			if (sevrOut) sevrOut[idx] = severity;
+			if (errOut) errOut[idx] = lvCode;
+			if (connOut) connOut[idx] = connected ? 1 : 0;
+		};
+		if (fullRefresh || (st.changedIndices.empty() && errorIndices.empty())) {
+			for (uInt32 i = 0; i < nameCount; ++i) writeIndex(i);
+		}
+		else {
+			for (uInt32 idx : st.changedIndices) writeIndex(idx);
+			for (uInt32 idx : errorIndices) writeIndex(idx);
+		}
+	}
+
+	endLeanRead(PvIndexArray, st, CommunicationStatus);
+}
+
+static bool issuePollGet(PVItem* pvItem);
+
+extern "C" EXPORT void waitForChange(sLongArrayHdl* PvIndexArray, double Timeout, sUInt32ArrayHdl* ChangedIndices, LVBoolean* TimedOut)
+{
+	*TimedOut = 1;
+	if (PvIndexArray == nullptr || *PvIndexArray == nullptr || DSCheckHandle(*PvIndexArray) != noErr) {
+		return;
+	}
+	Globals& g = Globals::getInstance();
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<long long>((Timeout > 0.0 ? Timeout : 0.0) * 1000.0));
+	// Waits are cut into slices only to notice shutdown; changes wake the wait immediately.
+	const auto slice = std::chrono::milliseconds(100);
+	auto remainingSlice = [&](std::chrono::milliseconds cap) {
+		const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+		return std::max(std::chrono::milliseconds(0), std::min(remaining, cap));
+	};
+	std::vector<uint32_t> pending;
+	std::shared_ptr<PvDirtySet> dirtySet = findDirtySet(PvIndexArray);
+	if (dirtySet && !g.bCaLabPolling) {
+		// Sleep on the index array's own dirty set. Marks not yet drained by getValue are
+		// pending changes too, so they are returned at once.
+		while (!g.stopped.load()) {
+			pending = dirtySet->waitPending(remainingSlice(slice));
+			if (!pending.empty() || std::chrono::steady_clock::now() >= deadline) {
+				break;
+			}
+		}
+	}
+	else {
+		// No dirty set of our own (no live entry was built with one), or CALAB_POLLING where the
+		// shared set is drained by getValue's own reads: listen with a private set and report the
+		// indices whose change hash differs from the one at call start.
+		const uInt32 count = (**PvIndexArray) ? (**PvIndexArray)->dimSize : 0;
+		auto watch = std::make_shared<PvDirtySet>(count);
+		watch->drain();
+		std::vector<std::size_t> hashes(count, 0);
+		std::vector<PVItem*> items(count, nullptr);
+		for (uInt32 i = 0; i < count; ++i) {
+			PvEntryHandle entry{ PvIndexArray, i };
+			if (!entry || !entry->pvItem) continue;
+			items[i] = entry->pvItem;
+			items[i]->addChangeListener(watch, i);
+			hashes[i] = items[i]->getChangeHash();
+		}
+		// Polling mode has no monitors: read the channels in rounds through the pipelined get path.
+		const auto pollRound = std::chrono::milliseconds(100);
+		auto nextRound = std::chrono::steady_clock::now();
+		if (g.bCaLabPolling && ca_current_context() == nullptr && g.pcac) {
+			ca_attach_context(g.pcac);
+		}
+		while (!g.stopped.load()) {
+			auto cap = slice;
+			if (g.bCaLabPolling) {
+				const auto now = std::chrono::steady_clock::now();
+				if (now >= nextRound) {
+					bool issued = false;
+					for (PVItem* pvItem : items) {
+						if (pvItem && issuePollGet(pvItem)) issued = true;
+					}
+					if (issued) ca_flush_io();
+					nextRound = now + pollRound;
+				}
+				cap = std::min(cap, std::chrono::duration_cast<std::chrono::milliseconds>(nextRound - now));
+			}
+			watch->waitPending(remainingSlice(cap));
+			for (uint32_t i : watch->drain()) {
+				if (items[i] && items[i]->getChangeHash() != hashes[i]) pending.push_back(i);
+			}
+			if (!pending.empty() || std::chrono::steady_clock::now() >= deadline) {
+				break;
+			}
+		}
+	}
+	std::sort(pending.begin(), pending.end());
+
+	if (ChangedIndices) {
+		bool resized = false;
+		MgErr err = resizeNumericArray1D(uL, ChangedIndices, static_cast<uInt32>(pending.size()), resized);
+		if (err != noErr) {
+			CaLabDbgPrintf("waitForChange: Error resizing ChangedIndices: %d", err);
+			return;
+		}
+		if (!pending.empty()) {
+			memcpy((**ChangedIndices)->elt, pending.data(), pending.size() * sizeof(uInt32));
+		}
+	}
+	*TimedOut = pending.empty() ? 1 : 0;
+}
+
+extern "C" EXPORT void preconnectPVs(sStringArrayHdl* PvNameArray, LStrHandle FilePath, uInt32* PvCount)
+{
+	if (PvCount) *PvCount = 0;
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) return;
+
+	auto trim = [](std::string s) {
+		const char* ws = " \t\r\n";
+		size_t first = s.find_first_not_of(ws);
+		if (first == std::string::npos) return std::string();
+		size_t last = s.find_last_not_of(ws);
+		return s.substr(first, last - first + 1);
+		};
+
+	// Collect distinct names from the array and the file, keeping their order.
+	std::vector<std::string> names;
+	std::unordered_set<std::string> seen;
+	auto addName = [&](std::string name) {
+		name = trim(std::move(name));
+		if (!name.empty() && seen.insert(name).second) {
+			names.push_back(std::move(name));
+		}
+		};
+	if (PvNameArray && *PvNameArray && DSCheckHandle(*PvNameArray) == noErr && **PvNameArray) {
+		for (uInt32 i = 0; i < (**PvNameArray)->dimSize; ++i) {
+			LStrHandle h = (**PvNameArray)->elt[i];
+			if (h && *h && (*h)->cnt > 0) {
+				addName(std::string(reinterpret_cast<const char*>((*h)->str), static_cast<size_t>((*h)->cnt)));
+			}
+		}
+	}
+	if (FilePath && *FilePath && (*FilePath)->cnt > 0) {
+		std::string path(reinterpret_cast<const char*>((*FilePath)->str), static_cast<size_t>((*FilePath)->cnt));
+		std::ifstream in(path);
+		if (!in) {
+			CaLabDbgPrintf("preconnectPVs: Could not open %s", path.c_str());
+		}
+		std::string line;
+		while (std::getline(in, line)) {
+			size_t comment = line.find('#');
+			if (comment != std::string::npos) line.resize(comment);
+			addName(std::move(line));
+		}
+	}
+	if (names.empty()) return;
+
+	CaContextGuard _caThreadAttach;
+
+	// Create registry entries and channels; ca_create_channel only queues the search.
+	std::vector<PVItem*> alreadyConnected;
+	{
+		TimeoutUniqueLock<std::shared_timed_mutex> lock(g.pvRegistryLock, "preconnectPVs", std::chrono::milliseconds(500));
+		if (!lock.isLocked()) {
+			CaLabDbgPrintf("preconnectPVs: Failed to acquire pvRegistryLock");
+			return;
+		}
+		for (const auto& name : names) {
+			PVItem* pvItem = nullptr;
+			auto it = g.pvRegistry.find(name);
+			if (it == g.pvRegistry.end()) {
+				auto newPvItem = std::make_unique<PVItem>(name);
+				pvItem = newPvItem.get();
+				g.pvRegistry[name] = std::move(newPvItem);
+				g.seedFromMetadataCache(pvItem);
+			}
+			else {
+				pvItem = it->second.get();
+			}
+			if (!pvItem) continue;
+			pvItem->setPrefetchWanted();
+			if (pvItem->isConnected()) {
+				alreadyConnected.push_back(pvItem);
+			}
+			else {
+				connectPv(pvItem, /*connectRtyp=*/false);
+			}
+		}
+	}
+	// CALAB_POLLING reads values with explicit gets; connecting is all that can be done ahead.
+	if (!g.bCaLabPolling) {
+		for (auto* pvItem : alreadyConnected) {
+			subscribePv(pvItem);
+		}
+	}
+	ca_flush_io();
+	if (PvCount) *PvCount = static_cast<uInt32>(names.size());
+}
+
+namespace {
+	// Per-thread scratch arena for putValue conversions. The buffers only grow, so repeated
+	// writes of the same shape allocate nothing; ca_array_put copies the data before returning.
+	struct PutScratch {
+		std::vector<unsigned char> target;
+		std::vector<double> parsed;
+		std::vector<double> monitored;
+		std::string text;
+
+		template <typename T>
+		T* targetAs(uInt32 count) {
+			const size_t bytes = static_cast<size_t>(count) * sizeof(T);
+			if (target.size() < bytes) target.resize(bytes);
+			return reinterpret_cast<T*>(target.data());
+		}
+	};
+	thread_local PutScratch t_putScratch;
+
+	// PutSlot::status until the put callback of a wait4readback write has fired.
+	constexpr int kPutPending = -1;
+	// Returned by issuePut when an unchanged write was skipped.
+	constexpr int kPutSuppressed = -2;
+
+	// Converts one source value to a numeric DBR type: floating sources are truncated toward
+	// zero and clamped to the target range, integer sources are clamped, except for CHAR
+	// targets where integers are written as raw bytes.
+	template <typename Dst, typename Src>
+	inline Dst convertPutElement(Src v) {
+		if constexpr (std::is_floating_point_v<Dst>) {
+			return static_cast<Dst>(v);
+		}
+		else if constexpr (std::is_integral_v<Src> && sizeof(Dst) == 1) {
+			return static_cast<Dst>(static_cast<uint8_t>(v));
+		}
+		else if constexpr (std::is_floating_point_v<Src>) {
+			constexpr Src lo = static_cast<Src>(std::numeric_limits<Dst>::min());
+			constexpr Src hi = static_cast<Src>(std::numeric_limits<Dst>::max());
+			v = v < lo ? lo : v;
+			v = v > hi ? hi : v;
+			return static_cast<Dst>(v);
+		}
+		else {
+			constexpr int64_t lo = static_cast<int64_t>(std::numeric_limits<Dst>::min());
+			constexpr int64_t hi = static_cast<int64_t>(std::numeric_limits<Dst>::max());
+			const int64_t w = static_cast<int64_t>(v);
+			return static_cast<Dst>(w < lo ? lo : (w > hi ? hi : w));
+		}
+	}
+
+	// Converts a block of source values into the scratch arena. Storage is the element type of
+	// the LabVIEW array, Src the logical value type (e.g. int16_t packed in a uint64_t).
+	template <typename Dst, typename Src, typename Storage>
+	const void* convertPutBlock(const Storage* src, uInt32 count) {
+		Dst* dst = t_putScratch.targetAs<Dst>(count);
+		if constexpr (std::is_same_v<Dst, dbr_string_t>) {
+			for (uInt32 j = 0; j < count; ++j) {
+				if constexpr (std::is_floating_point_v<Src>) std::snprintf(dst[j], sizeof(dbr_string_t), "%.15g", static_cast<double>(static_cast<Src>(src[j])));
+				else std::snprintf(dst[j], sizeof(dbr_string_t), "%" PRId64, static_cast<int64_t>(static_cast<Src>(src[j])));
+			}
+		}
+		else {
+			for (uInt32 j = 0; j < count; ++j) dst[j] = convertPutElement<Dst>(static_cast<Src>(src[j]));
+		}
+		return dst;
+	}
+
+	// Conversion matrix: source value type x native DBF type of the target channel, generated at
+	// compile time. Returns the buffer for ca_array_put and its DBR type; doubles written to
+	// DOUBLE fields are passed through without a copy.
+	template <typename Src, typename Storage>
+	const void* convertForPut(const Storage* src, uInt32 count, short nativeType, chtype& dbrType) {
+		switch (nativeType) {
+		case DBF_STRING: dbrType = DBR_STRING; return convertPutBlock<dbr_string_t, Src>(src, count);
+		case DBF_SHORT:  dbrType = DBR_SHORT;  return convertPutBlock<dbr_short_t, Src>(src, count);
+		case DBF_FLOAT:  dbrType = DBR_FLOAT;  return convertPutBlock<dbr_float_t, Src>(src, count);
+		case DBF_ENUM:   dbrType = DBR_ENUM;   return convertPutBlock<dbr_enum_t, Src>(src, count);
+		case DBF_CHAR:   dbrType = DBR_CHAR;   return convertPutBlock<dbr_char_t, Src>(src, count);
+		case DBF_LONG:   dbrType = DBR_LONG;   return convertPutBlock<dbr_long_t, Src>(src, count);
+		default:
+			// DOUBLE and unknown native types: floating sources as DBR_DOUBLE, integers as DBR_LONG.
+			if constexpr (std::is_floating_point_v<Src>) {
+				dbrType = DBR_DOUBLE;
+				if constexpr (std::is_same_v<Storage, dbr_double_t>) return src;
+				else return convertPutBlock<dbr_double_t, Src>(src, count);
+			}
+			else {
+				dbrType = (nativeType == DBF_DOUBLE) ? DBR_DOUBLE : DBR_LONG;
+				return (nativeType == DBF_DOUBLE) ? convertPutBlock<dbr_double_t, Src>(src, count) : convertPutBlock<dbr_long_t, Src>(src, count);
+			}
+		}
+	}
+
+	// Integer input of putValue: LabVIEW packs I8/I16/I32/I64 values into a uint64_t array.
+	const void* convertIntegersForPut(const uint64_t* src, uInt32 count, short nativeType, chtype& dbrType,
+		bool isChar, bool isShort, bool isLong32) {
+		if (isChar)   return convertForPut<int8_t>(src, count, nativeType, dbrType);
+		if (isShort)  return convertForPut<int16_t>(src, count, nativeType, dbrType);
+		if (isLong32) return convertForPut<int32_t>(src, count, nativeType, dbrType);
+		return convertForPut<int64_t>(src, count, nativeType, dbrType);
+	}
+
+	struct PutCtx;
+	// Completion record of one PV of a confirmed put batch; the usr pointer of its put callback.
+	struct PutSlot {
+		PutCtx* owner = nullptr;
+		std::chrono::steady_clock::time_point issued;
+		std::atomic<int> status{ kPutPending };
+		std::atomic<long long> latencyUs{ -1 };
+	};
+	// Shared by all puts of one batch; freed by whoever drops the last reference.
+	struct PutCtx {
+		explicit PutCtx(uInt32 count) : slots(new PutSlot[count ? count : 1]) {
+			for (uInt32 i = 0; i < count; ++i) slots[i].owner = this;
+		}
+		std::atomic<uInt32> completed{ 0 };
+		std::atomic<uInt32> refs{ 1 };
+		std::unique_ptr<PutSlot[]> slots;
+	};
+
+	void putCompleted(struct event_handler_args args) {
+		PutSlot* slot = static_cast<PutSlot*>(args.usr);
+		if (!slot || !slot->owner) {
+			return;
+		}
+		PutCtx* ctx = slot->owner;
+		slot->latencyUs.store(std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - slot->issued).count(), std::memory_order_relaxed);
+		slot->status.store(args.status, std::memory_order_release);
+		ctx->completed.fetch_add(1, std::memory_order_relaxed);
+		Globals::getInstance().notify();
+		if (ctx->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			delete ctx;
+			ctx = nullptr;
+		}
+	}
+
+	size_t putElementSize(chtype type) {
+		switch (type) {
+		case DBR_STRING: return sizeof(dbr_string_t);
+		case DBR_SHORT:  return sizeof(dbr_short_t);
+		case DBR_FLOAT:  return sizeof(dbr_float_t);
+		case DBR_ENUM:   return sizeof(dbr_enum_t);
+		case DBR_CHAR:   return sizeof(dbr_char_t);
+		case DBR_LONG:   return sizeof(dbr_long_t);
+		default:         return sizeof(dbr_double_t);
+		}
+	}
+
+	double putElementAsDouble(chtype type, const void* data, uInt32 j) {
+		switch (type) {
+		case DBR_SHORT: return static_cast<const dbr_short_t*>(data)[j];
+		case DBR_FLOAT: return static_cast<const dbr_float_t*>(data)[j];
+		case DBR_ENUM:  return static_cast<const dbr_enum_t*>(data)[j];
+		case DBR_CHAR:  return static_cast<const dbr_char_t*>(data)[j];
+		case DBR_LONG:  return static_cast<const dbr_long_t*>(data)[j];
+		default:        return static_cast<const dbr_double_t*>(data)[j];
+		}
+	}
+
+	// True if the PV is monitored and its monitored value equals the payload. Without a live
+	// subscription the cached value may be stale, so nothing is considered unchanged.
+	bool putMatchesMonitor(PVItem* item, chtype type, uInt32 count, const void* data) {
+		std::lock_guard<std::mutex> lk(item->ioMutex());
+		if (item->eventId == nullptr || !item->hasValue() || item->getNumberOfValues() != count) {
+			return false;
+		}
+		if (type == DBR_STRING) {
+			const std::vector<std::string> current = item->dbrValue2String();
+			if (current.size() != count) return false;
+			const dbr_string_t* strings = static_cast<const dbr_string_t*>(data);
+			for (uInt32 j = 0; j < count; ++j) {
+				if (current[j].compare(0, std::string::npos, strings[j], strnlen(strings[j], sizeof(dbr_string_t))) != 0) return false;
+			}
+			return true;
+		}
+		std::vector<double>& current = t_putScratch.monitored;
+		if (current.size() < count) current.resize(count);
+		if (item->dbrValue2Double(current.data(), count) != count) {
+			return false;
+		}
+		for (uInt32 j = 0; j < count; ++j) {
+			if (current[j] != putElementAsDouble(type, data, j)) return false;
+		}
+		return true;
+	}
+
+	// Issues ca_array_put, or ca_array_put_callback tracked in slot `index` of putCtx if given.
+	// With CALAB_SUPPRESS_UNCHANGED_WRITES, a fire-and-forget payload equal to the last write
+	// of `item` (or, with "monitor", to any value) is not sent while the monitored value still
+	// equals it; kPutSuppressed is returned instead. Callback puts (wait4readback, async) are
+	// always sent because the caller waits for the server's confirmation.
+	int issuePut(uInt32 index, chtype type, unsigned long count, chid ch, const void* data, PutCtx* putCtx, uInt32& totalWrites, PVItem* item) {
+		if (ca_state(ch) != cs_conn) {
+			return ECA_DISCONN;
+		}
+		Globals& g = Globals::getInstance();
+		const bool suppressUnchanged = item && g.bCaLabSuppressUnchangedWrites;
+		const size_t payloadSize = suppressUnchanged ? putElementSize(type) * count : 0;
+		if (suppressUnchanged && !putCtx
+			&& (g.bCaLabSuppressMatchesMonitor || item->isLastPut(type, count, data, payloadSize))
+			&& putMatchesMonitor(item, type, count, data)) {
+			g.putsSuppressed.fetch_add(1, std::memory_order_relaxed);
+			return kPutSuppressed;
+		}
+		int rc = ECA_NORMAL;
+		if (!putCtx) {
+			rc = ca_array_put(type, count, ch, data);
+		}
+		else {
+			putCtx->refs.fetch_add(1, std::memory_order_relaxed);
+			PutSlot& slot = putCtx->slots[index];
+			slot.issued = std::chrono::steady_clock::now();
+			rc = ca_array_put_callback(type, count, ch, data, putCompleted, &slot);
+			if (rc == ECA_NORMAL) {
+				totalWrites++;
+			}
+			else {
+				putCtx->refs.fetch_sub(1, std::memory_order_acq_rel);
+			}
+		}
+		if (rc == ECA_NORMAL) {
+			g.putsIssued.fetch_add(1, std::memory_order_relaxed);
+			if (suppressUnchanged) item->setLastPut(type, static_cast<uInt32>(count), data, payloadSize);
+		}
+		else if (suppressUnchanged) {
+			item->clearLastPut();
+		}
+		return rc;
+	}
+
+	// Maps PV i of a put call to its slice of the row-major value array: one row per PV,
+	// one row for a single PV, or one column per PV.
+	void putSourceRange(uInt32 i, uInt32 nameCount, uInt32 rows, uInt32 cols, uInt32& availableCount, size_t& startIndex) {
+		availableCount = 1;
+		startIndex = 0;
+		if (rows == nameCount) {
+			availableCount = (cols ? cols : 1u);
+			startIndex = static_cast<size_t>(i) * (cols ? cols : 1u);
+		}
+		else {
+			if (nameCount == 1) { availableCount = (cols ? cols : 1u); startIndex = 0; }
+			else {
+				if (cols == 1) { availableCount = 1; startIndex = 0; }
+				else if (cols == nameCount) { availableCount = 1; startIndex = i; }
+				else { availableCount = (cols ? cols : 1u); startIndex = 0; }
+			}
+		}
+	}
+
+	// Numeric put string parsing lives in numericParse.h (shared with tools/bench_parse_numeric.cpp).
+	using numericparse::DecimalSeparator;
+	using numericparse::detectDecimalSeparator;
+	using numericparse::parseNumericString;
+
+	// String input: DBR_STRING for STRING fields, the first string as CHAR array for CHAR fields,
+	// otherwise parsed as numbers. textAt(j, text, len) yields the j-th string. Returns nullptr
+	// if a numeric string is invalid.
+	template <typename TextAt>
+	const void* convertStringsForPut(TextAt textAt, uInt32 nToWrite, short nativeType, unsigned elementCapacity,
+		chtype& dbrType, uInt32& count) {
+		const char* text = nullptr;
+		size_t len = 0;
+		count = nToWrite;
+		if (nativeType == DBF_STRING) {
+			dbrType = DBR_STRING;
+			dbr_string_t* temp = t_putScratch.targetAs<dbr_string_t>(nToWrite);
+			for (uInt32 j = 0; j < nToWrite; ++j) {
+				textAt(j, text, len);
+				len = std::min(len, sizeof(dbr_string_t) - 1);
+				memcpy(temp[j], text, len);
+				temp[j][len] = '\0';
+			}
+			return temp;
+		}
+		if (nativeType == DBF_CHAR) {
+			// A single string is written as a CHAR array (e.g. long strings in waveforms).
+			static const dbr_char_t zero = 0;
+			dbrType = DBR_CHAR;
+			textAt(0, text, len);
+			count = (uInt32)std::min<size_t>(elementCapacity ? elementCapacity : len, len);
+			if (count == 0) { count = 1; return &zero; }
+			return text;
+		}
+		std::vector<double>& numericValues = t_putScratch.parsed;
+		if (numericValues.size() < nToWrite) numericValues.resize(nToWrite);
+		const DecimalSeparator sep = detectDecimalSeparator(textAt, nToWrite);
+		for (uInt32 j = 0; j < nToWrite; ++j) {
+			textAt(j, text, len);
+			if (!parseNumericString(text, len, sep, t_putScratch.text, numericValues[j])) return nullptr;
+		}
+		return convertForPut<double>(numericValues.data(), nToWrite, nativeType, dbrType);
+	}
+
+	// Optional readback verification of a put (putValueVerify).
+	struct PutVerifyRequest {
+		double tolerance;
+		sDoubleArray2DHdl* readbackArray;
+		sBooleanArrayHdl* verified;
+	};
+}
+
+static void putValueImpl(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, const PutVerifyRequest* verify);
+
+extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall) {
+	putValueImpl(PvNameArray, PvIndexArray, StringValueArray2D, DoubleValueArray2D, LongValueArray2D, DataType, Timeout, wait4readback, ErrorArray, CommunicationStatus, FirstCall, nullptr);
+}
+
+extern "C" EXPORT void putValueVerify(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, double Tolerance, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, sDoubleArray2DHdl* ReadbackArray, sBooleanArrayHdl* Verified, LVBoolean* CommunicationStatus, LVBoolean* FirstCall) {
+	const PutVerifyRequest verify{ Tolerance < 0.0 ? 0.0 : Tolerance, ReadbackArray, Verified };
+	putValueImpl(PvNameArray, PvIndexArray, StringValueArray2D, DoubleValueArray2D, LongValueArray2D, DataType, Timeout, wait4readback, ErrorArray, CommunicationStatus, FirstCall, &verify);
+}
+
+static void putValueImpl(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, const PutVerifyRequest* verify) {
+	if (PvIndexArray == nullptr || PvNameArray == nullptr || *PvNameArray == nullptr || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
+		if (CommunicationStatus) *CommunicationStatus = 1;
+		return;
+	}
+
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) { if (CommunicationStatus) *CommunicationStatus = 1; return; }
+
+	// Ensure this thread is attached to the CA context while using CA APIs.
+	CaContextGuard _caThreadAttach;
+
+	// Validate PV names.
+	if (!PvNameArray || !*PvNameArray || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
+		if (CommunicationStatus) *CommunicationStatus = 1;
+		return;
+	}
+	const uInt32 nameCount = static_cast<uInt32>((**PvNameArray)->dimSize);
+
+	// Determine which value array to use based on DataType.
+	const bool isString = (DataType == DT_STRING);
+	const bool isDouble = (DataType == DT_SINGLE || DataType == DT_DOUBLE);
+	const bool isChar = (DataType == DT_CHAR);
+	const bool isShort = (DataType == DT_SHORT);
+	const bool isLong32 = (DataType == DT_LONG);
+	const bool isQuad64 = (DataType == DT_QUAD);
+
+	// === Resolve instance binding early (similar to getValue) ===
+	MyInstanceData* instanceData = nullptr;
+	InstanceDataPtr* ownerPtr = nullptr;
+	{
+		std::lock_guard<std::mutex> instLock(g.instancesMutex);
+
+		// Try to find existing instance from array handles
+		if (PvIndexArray && *PvIndexArray) {
+			ownerPtr = g.getInstanceForArray(static_cast<void*>(*PvIndexArray));
+		}
+
+		// Fallback: find a suitable instance
+		if (!ownerPtr && !g.instances.empty()) {
+			// Priority 1: Find an unused instance (no function name set yet)
+			for (auto it = g.instances.rbegin(); it != g.instances.rend(); ++it) {
+				if (*it && **it) {
+					MyInstanceData* candidate = static_cast<MyInstanceData*>(**it);
+					if (candidate && !candidate->isUnreserving.load(std::memory_order_acquire)
+						&& candidate->firstFunctionName.empty()) {
+						ownerPtr = *it;
+						break;
+					}
+				}
+			}
+			// Priority 2: Find an instance already assigned to putValue
+			if (!ownerPtr) {
+				for (auto it = g.instances.rbegin(); it != g.instances.rend(); ++it) {
+					if (*it && **it) {
+						MyInstanceData* candidate = static_cast<MyInstanceData*>(**it);
+						if (candidate && !candidate->isUnreserving.load(std::memory_order_acquire)
+							&& candidate->firstFunctionName == "putValue") {
 							ownerPtr = *it;
 							break;
 						}
@@ -1150,71 +2032,10 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 		bool isQuad64;
 
 		static std::string getLVString(LStrHandle h) {
-			if (!h) return std::string();
-			const size_t len = static_cast<size_t>((*h)->cnt);
-			const char* s = reinterpret_cast<const char*>((*h)->str);
-			return std::string(s, len);
-		}
-
-		static bool parseNumericString(const std::string& txt, double& out) {
-			auto parseClassic = [](const std::string& s, double& value) -> bool {
-				const char* start = s.c_str();
-				char* end = nullptr;
-#if defined _WIN32 || defined _WIN64
-				static _locale_t cLocale = _create_locale(LC_NUMERIC, "C");
-				value = _strtod_l(start, &end, cLocale);
-#else
-				static locale_t cLocale = newlocale(LC_NUMERIC_MASK, "C", nullptr);
-				if (cLocale) {
-					value = strtod_l(start, &end, cLocale);
-				}
-				else {
-					value = std::strtod(start, &end);
-				}
-#endif
-				if (start == end) return false;
-				while (*end && std::isspace(static_cast<unsigned char>(*end))) { ++end; }
-				return (*end == '\0');
-			};
-
-			if (parseClassic(txt, out)) return true;
-
-			size_t lastComma = std::string::npos;
-			size_t lastDot = std::string::npos;
-			for (size_t i = 0; i < txt.size(); ++i) {
-				if (txt[i] == ',') lastComma = i;
-				else if (txt[i] == '.') lastDot = i;
-			}
-			const bool hasComma = (lastComma != std::string::npos);
-			const bool hasDot = (lastDot != std::string::npos);
-
-			if (!hasComma && !hasDot) {
-				return false;
-			}
-
-			// Normalize decimal separators to allow both "1.23" and "1,23".
-			if (!hasComma && hasDot) return false;
-
-			char decimal = ',';
-			char thousands = '\0';
-			if (hasComma && hasDot) {
-				if (lastComma > lastDot) { decimal = ','; thousands = '.'; }
-				else { decimal = '.'; thousands = ','; }
-			}
-
-			std::string normalized;
-			normalized.reserve(txt.size());
-			for (char c : txt) {
-				if (thousands && c == thousands) continue;
-				if (c == decimal) normalized.push_back('.');
-				else normalized.push_back(c);
-			}
-
-			if (normalized == txt) {
-				return false;
-			}
-
-			return parseClassic(normalized, out);
+			if (!h) return std::string();
+			const size_t len = static_cast<size_t>((*h)->cnt);
+			const char* s = reinterpret_cast<const char*>((*h)->str);
+			return std::string(s, len);
 		}
 
 		void ensureErrorArray(uInt32 n) {
@@ -1259,34 +2080,57 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 			else if (isString && StringValueArray2D && *StringValueArray2D) { rows = (**StringValueArray2D)->dimSizes[0]; cols = (**StringValueArray2D)->dimSizes[1]; }
 		}
 
+		// Replaces index entry i by a fresh entry for pvItem (no-op without a usable PvIndexArray).
+		void storeIndexEntry(uInt32 i, PVItem* pvItem) {
+			if (!PvIndexArray || !*PvIndexArray || !**PvIndexArray || (**PvIndexArray)->dimSize <= i) {
+				return;
+			}
+			// Atomically claim and delete old element if present
+			tryClaimAndDeletePvIndexEntry(&(**PvIndexArray)->elt[i]);
+
+			PVMetaInfo* metaInfo = new PVMetaInfo(pvItem);
+			metaInfo->functionName = "putValue";
+			PvIndexEntry* entry = new PvIndexEntry(pvItem, metaInfo);
+			if (entry->token()) {
+				auto atomicElt = reinterpret_cast<atomic_ptr_t*>(&(**PvIndexArray)->elt[i]);
+				atomicElt->store(entry->token(), std::memory_order_release);
+			}
+			else {
+				CaLabDbgPrintf("putValue: PvIndexEntry slot table exhausted for %s", pvItem->getName().c_str());
+				delete metaInfo;
+				delete entry;
+			}
+		}
+
 		PVItem* getPvItemForIndex(uInt32 i) {
 			if (!PvNameArray || !*PvNameArray || i >= (**PvNameArray)->dimSize) {
 				return nullptr;
 			}
 
 			LStrHandle h = (**PvNameArray)->elt[i];
-			if (!h || !*h) {
-				return nullptr;
-			}
-
-			std::string pvName(reinterpret_cast<const char*>((*h)->str), (*h)->cnt);
-			if (pvName.empty()) {
+			if (!h || !*h || (*h)->cnt <= 0) {
 				return nullptr;
 			}
+			const char* nameChars = reinterpret_cast<const char*>((*h)->str);
+			const size_t nameLength = static_cast<size_t>((*h)->cnt);
 
-			// ---- atomischer Leseversuch mit schneller Validierung ----
+			// Fast path: a populated PvIndexArray entry is trusted once its PV name matches the
+			// requested one byte for byte; no string is built and pvRegistryLock is not taken.
+			bool staleEntry = false;
 			if (PvIndexArray && *PvIndexArray && **PvIndexArray && (**PvIndexArray)->dimSize > i) {
-				PvEntryHandle entry{ PvIndexArray, i};
-				if (entry) {
-					PVItem* result = entry->pvItem;
-					if (result) {
-						// Note: caller must still handle nullptr result.
-						return result;
+				PvEntryHandle entry{ PvIndexArray, i };
+				if (entry && entry->pvItem) {
+					const std::string& itemName = entry->pvItem->getName();
+					if (itemName.size() == nameLength && memcmp(itemName.data(), nameChars, nameLength) == 0) {
+						return entry->pvItem;
 					}
+					// The name at this index changed since the entry was created.
+					staleEntry = true;
 				}
-				// If we couldn't obtain PV from index array, fall through to registry lookup below.
 			}
 
+			std::string pvName(nameChars, nameLength);
+
 			// Lookup in registry (shared lock)
 			{
 				TimeoutSharedLock<std::shared_timed_mutex> sharedLock(
@@ -1298,6 +2142,8 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 						if (!item->isConnected()) {
 							connectPv(item, false);
 						}
+						// Re-point the index entry so the next call takes the fast path.
+						storeIndexEntry(i, item);
 						return item;
 					}
 				}
@@ -1325,28 +2171,15 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 
 				auto it = globals.pvRegistry.find(pvName);
 				if (it != globals.pvRegistry.end()) {
+					if (staleEntry) storeIndexEntry(i, it->second.get());
 					return it->second.get();
 				}
 
 				auto newPv = std::make_unique<PVItem>(pvName);
 				PVItem* pvItem = newPv.get();
 				globals.pvRegistry[pvName] = std::move(newPv);
-
-				// Atomically claim and delete old element if present
-				if (PvIndexArray && *PvIndexArray && **PvIndexArray && (**PvIndexArray)->dimSize > i) {
-					tryClaimAndDeletePvIndexEntry(&(**PvIndexArray)->elt[i]);
-				}
-
-				const bool canStoreIndex =
-					(PvIndexArray && *PvIndexArray && **PvIndexArray && (**PvIndexArray)->dimSize > i);
-				if (canStoreIndex) {
-					PVMetaInfo* metaInfo = new PVMetaInfo(pvItem);
-					metaInfo->functionName = "putValue";
-					PvIndexEntry* entry = new PvIndexEntry(pvItem, metaInfo);
-
-					auto atomicElt = reinterpret_cast<atomic_ptr_t*>(&(**PvIndexArray)->elt[i]);
-					atomicElt->store(reinterpret_cast<uintptr_t>(entry), std::memory_order_release);
-				}
+				globals.seedFromMetadataCache(pvItem);
+				storeIndexEntry(i, pvItem);
 
 				connectPv(pvItem, false);
 				return pvItem;
@@ -1355,43 +2188,6 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 			return nullptr;
 		}
 
-		struct PutCtx {
-			std::atomic<uInt32> completed{ 0 };
-			std::atomic<uInt32> refs{ 1 };
-		};
-
-		int doPut(chtype type, unsigned long count, chid ch, const void* data,
-			bool doWaitRequested, PutCtx* putCtx, uInt32& totalWrites) {
-			if (ca_state(ch) != cs_conn) {
-				return ECA_DISCONN;
-			}
-			if (doWaitRequested) {
-				putCtx->refs.fetch_add(1, std::memory_order_relaxed);
-				auto putCallback = [](struct event_handler_args args) {
-					PutCtx* ctx = static_cast<PutCtx*>(args.usr);
-					if (!ctx) {
-						return;
-					}
-					ctx->completed.fetch_add(1, std::memory_order_relaxed);
-					Globals::getInstance().notify();
-					if (ctx->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-						delete ctx;
-						ctx = nullptr;
-					}
-					};
-				int rc = ca_array_put_callback(type, count, ch, data, putCallback, putCtx);
-				if (rc == ECA_NORMAL) {
-					totalWrites++;
-				}
-				else {
-					putCtx->refs.fetch_sub(1, std::memory_order_acq_rel);
-				}
-				return rc;
-			}
-			else {
-				return ca_array_put(type, count, ch, data);
-			}
-		}
 	};
 
 	PutValueCtx ctx{ g, PvNameArray, PvIndexArray, StringValueArray2D, DoubleValueArray2D, LongValueArray2D, ErrorArray,
@@ -1482,30 +2278,17 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 		ca_flush_io();
 
 		if (!toConnect.empty()) {
+			// connectionChanged counts the latch down, so this returns as soon as the last channel is up.
 			const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
-			while (true) {
-				bool allConnected = true;
-				for (uInt32 idx : toConnect) {
-					PVItem* p = items[idx];
-					if (!p || !p->channelId || !p->isConnected()) { allConnected = false; break; }
-				}
-				if (allConnected) break;
-
-				const auto now = std::chrono::steady_clock::now();
-				if (now >= deadline) {
-					uInt32 notConnected = 0;
-					for (uInt32 idx : toConnect) {
-						PVItem* p = items[idx];
-						if (!p || !p->channelId || !p->isConnected()) { ++notConnected; }
-					}
-					if (CommunicationStatus) *CommunicationStatus = 1;
-					break;
+			auto latch = std::make_shared<PvConnectLatch>(static_cast<uint32_t>(toConnect.size()));
+			for (uInt32 idx : toConnect) {
+				PVItem* p = items[idx];
+				if (!p || !p->addConnectWaiter(latch)) {
+					latch->countDown();
 				}
-
-				const double remainingSec = std::chrono::duration<double>(deadline - now).count();
-				const double slice = remainingSec > 0.05 ? 0.05 : (remainingSec > 0.0 ? remainingSec : 0.0);
-				ca_pend_event(static_cast<double>(slice));
-				Globals::getInstance().waitForNotification(std::chrono::milliseconds(10));
+			}
+			if (!latch->waitUntil(deadline)) {
+				if (CommunicationStatus) *CommunicationStatus = 1;
 			}
 		}
 	}
@@ -1516,8 +2299,8 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 		}
 	}
 
-	// Stage B: If `doWaitRequested`, subscribe and wait for initial values.
-	if (doWaitRequested) {
+	// Stage B: If `doWaitRequested` or verifying, subscribe and wait for initial values.
+	if (doWaitRequested || verify) {
 		std::vector<uInt32> toSubscribe;
 		toSubscribe.reserve(nameCount);
 		for (uInt32 i = 0; i < nameCount; ++i) {
@@ -1552,7 +2335,10 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 	uInt32 totalWrites = 0;
 	bool putCallbacksTimedOut = false;
 
-	PutValueCtx::PutCtx* putCtx = doWaitRequested ? new PutValueCtx::PutCtx() : nullptr;
+	PutCtx* putCtx = doWaitRequested ? new PutCtx(nameCount) : nullptr;
+	// putValueVerify: written payload per PV, as numbers or (DBR_STRING) as strings.
+	std::vector<std::vector<double>> expectedNumbers(verify ? nameCount : 0);
+	std::vector<std::vector<std::string>> expectedStrings(verify ? nameCount : 0);
 
 	for (uInt32 i = 0; i < nameCount; ++i) {
 		PVItem* item = items[i];
@@ -1567,285 +2353,629 @@ extern "C" EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvI
 
 		uInt32 availableCount = 1;
 		size_t startIndex = 0;
-		if (rows == nameCount) {
-			availableCount = (cols ? cols : 1u);
-			startIndex = static_cast<size_t>(i) * (cols ? cols : 1u);
-		}
-		else {
-			if (nameCount == 1) { availableCount = (cols ? cols : 1u); startIndex = 0; }
-			else {
-				if (cols == 1) { availableCount = 1; startIndex = 0; }
-				else if (cols == nameCount) { availableCount = 1; startIndex = i; }
-				else { availableCount = (cols ? cols : 1u); startIndex = 0; }
-			}
-		}
+		putSourceRange(i, nameCount, rows, cols, availableCount, startIndex);
 
+		const uInt32 nToWrite = std::min<unsigned>(availableCount, elementCapacity ? elementCapacity : availableCount);
+		chtype dbrType = DBR_DOUBLE;
+		const void* data = nullptr;
+		uInt32 count = nToWrite;
 		if (isDouble) {
 			if (!DoubleValueArray2D || !*DoubleValueArray2D) {
 				ctx.setErrorAt(i, (uInt32)ECA_BADCOUNT, "Missing DoubleValueArray2D"); caStatus[i] = ECA_BADCOUNT;
 				if (CommunicationStatus) *CommunicationStatus = 1;
 				continue;
 			}
-			const uInt32 nToWrite = std::min<unsigned>(availableCount, elementCapacity ? elementCapacity : availableCount);
-			const double* basePtr = &((**DoubleValueArray2D)->elt[startIndex]);
-			if (nativeType == DBF_STRING) {
-				std::vector<dbr_string_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) std::snprintf(temp[j], sizeof(dbr_string_t), "%.15g", basePtr[j]);
-				caStatus[i] = ctx.doPut(DBR_STRING, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-			else if (nativeType == DBF_SHORT) {
-				std::vector<dbr_short_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_short_t>(std::max<long long>(std::numeric_limits<dbr_short_t>::min(), std::min<long long>(std::numeric_limits<dbr_short_t>::max(), static_cast<long long>(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_SHORT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-			else if (nativeType == DBF_FLOAT) {
-				std::vector<dbr_float_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_float_t>(basePtr[j]);
-				caStatus[i] = ctx.doPut(DBR_FLOAT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-			else if (nativeType == DBF_ENUM) {
-				std::vector<dbr_enum_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_enum_t>(std::max<long long>(0, std::min<long long>(std::numeric_limits<dbr_enum_t>::max(), static_cast<long long>(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_ENUM, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-			else if (nativeType == DBF_CHAR) {
-				std::vector<dbr_char_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_char_t>(std::max<long long>(0, std::min<long long>(255, static_cast<long long>(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_CHAR, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-			else if (nativeType == DBF_LONG) {
-				std::vector<dbr_long_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_long_t>(std::max<long long>(std::numeric_limits<dbr_long_t>::min(), std::min<long long>(std::numeric_limits<dbr_long_t>::max(), static_cast<long long>(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_LONG, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			data = convertForPut<double>(&((**DoubleValueArray2D)->elt[startIndex]), nToWrite, nativeType, dbrType);
+		}
+		else if (isChar || isShort || isLong32 || isQuad64) {
+			if (!LongValueArray2D || !*LongValueArray2D) {
+				ctx.setErrorAt(i, (uInt32)ECA_BADCOUNT, "Missing LongValueArray2D"); caStatus[i] = ECA_BADCOUNT;
+				if (CommunicationStatus) *CommunicationStatus = 1;
+				continue;
+			}
+			data = convertIntegersForPut(&((**LongValueArray2D)->elt[startIndex]), nToWrite, nativeType, dbrType, isChar, isShort, isLong32);
+		}
+		else if (isString) {
+			if (!StringValueArray2D || !*StringValueArray2D) {
+				ctx.setErrorAt(i, (uInt32)ECA_BADCOUNT, "Missing StringValueArray2D"); caStatus[i] = ECA_BADCOUNT;
+				if (CommunicationStatus) *CommunicationStatus = 1;
+				continue;
+			}
+			LStrHandle* strings = &((**StringValueArray2D)->elt[startIndex]);
+			auto lvText = [strings](uInt32 j, const char*& text, size_t& len) {
+				LStrHandle h = strings[j];
+				text = (h && *h) ? reinterpret_cast<const char*>((*h)->str) : "";
+				len = (h && *h) ? static_cast<size_t>((*h)->cnt) : 0;
+				};
+			data = convertStringsForPut(lvText, nToWrite, nativeType, elementCapacity, dbrType, count);
+			if (!data) { ctx.setErrorAt(i, (uInt32)ECA_BADTYPE, "Invalid numeric string(s)"); caStatus[i] = ECA_BADTYPE; continue; }
+		}
+		else {
+			continue;
+		}
+		caStatus[i] = issuePut(i, dbrType, count, channelID, data, putCtx, totalWrites, item);
+		const bool suppressed = (caStatus[i] == kPutSuppressed);
+		if (suppressed) caStatus[i] = ECA_NORMAL;
+		if (verify && caStatus[i] == ECA_NORMAL) {
+			if (dbrType == DBR_STRING) {
+				const dbr_string_t* strings = static_cast<const dbr_string_t*>(data);
+				for (uInt32 j = 0; j < count; ++j) expectedStrings[i].emplace_back(strings[j], strnlen(strings[j], sizeof(dbr_string_t)));
 			}
 			else {
-				caStatus[i] = ctx.doPut(DBR_DOUBLE, nToWrite, channelID, basePtr, doWaitRequested, putCtx, totalWrites);
+				expectedNumbers[i].resize(count);
+				for (uInt32 j = 0; j < count; ++j) expectedNumbers[i][j] = putElementAsDouble(dbrType, data, j);
 			}
+		}
 
-			auto updateError = [&]() {
-				const bool handleOk = (ErrorArray && *ErrorArray && (**ErrorArray) && i < (**ErrorArray)->dimSize);
-				bool needsUpdate = true;
-				if (handleOk) {
-					sError& e = (**ErrorArray)->result[i];
-					const uInt32 lvCode = (caStatus[i] <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(caStatus[i]) + ERROR_OFFSET;
-					if (e.code == lvCode && e.source && *e.source && (*e.source)->cnt > 0) {
-						needsUpdate = false;
-					}
+		auto updateError = [&]() {
+			const bool handleOk = (ErrorArray && *ErrorArray && (**ErrorArray) && i < (**ErrorArray)->dimSize);
+			bool needsUpdate = true;
+			if (handleOk) {
+				sError& e = (**ErrorArray)->result[i];
+				const uInt32 lvCode = (caStatus[i] <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(caStatus[i]) + ERROR_OFFSET;
+				if (e.code == lvCode && e.source && *e.source && (*e.source)->cnt > 0) {
+					needsUpdate = false;
 				}
-				if (caStatus[i] == ECA_NORMAL) {
-					ctx.setErrorAt(i, (uInt32)ECA_NORMAL, std::string(ca_message_safe(ECA_NORMAL)));
+			}
+			if (caStatus[i] == ECA_NORMAL) {
+				ctx.setErrorAt(i, (uInt32)ECA_NORMAL, std::string(ca_message_safe(ECA_NORMAL)) + (suppressed ? " (unchanged, write suppressed)" : ""));
+			}
+			else if (needsUpdate) {
+				ctx.setErrorAt(i, (uInt32)caStatus[i], "ca_array_put failed. " + std::string(ca_message_safe(caStatus[i])));
+			}
+			};
+		if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); updateError(); }
+		else { updateError(); }
+
+		if (CommunicationStatus) {
+			*CommunicationStatus = (caStatus[i] != ECA_NORMAL);
+		}
+	}
+	ca_poll();
+
+	// If using callbacks, wait for all write callbacks to complete.
+	if (doWaitRequested) {
+		bool callbacksTimedOut = false;
+		if (totalWrites > 0) {
+			const auto writeDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
+			while (std::chrono::steady_clock::now() < writeDeadline && putCtx->completed.load(std::memory_order_relaxed) < totalWrites) {
+				ca_pend_event(0.02);
+				Globals::getInstance().waitForNotification(std::chrono::milliseconds(10));
+			}
+			if (putCtx->completed.load(std::memory_order_relaxed) < totalWrites) {
+				callbacksTimedOut = true;
+			}
+		}
+		// Per-PV completion: report which puts failed or timed out, with their latency,
+		// so callers only need to repeat those.
+		auto reportCompletion = [&]() {
+			char msg[128];
+			for (uInt32 i = 0; i < nameCount; ++i) {
+				if (caStatus[i] != ECA_NORMAL) continue; // Not issued; error already reported.
+				const PutSlot& slot = putCtx->slots[i];
+				const int status = slot.status.load(std::memory_order_acquire);
+				const double latencyMs = slot.latencyUs.load(std::memory_order_relaxed) / 1000.0;
+				if (status == kPutPending) {
+					caStatus[i] = ECA_TIMEOUT;
+					std::snprintf(msg, sizeof(msg), "ca_array_put_callback not confirmed within %.0f ms", Timeout * 1000.0);
+					ctx.setErrorAt(i, (uInt32)ECA_TIMEOUT, msg);
+				}
+				else if (status != ECA_NORMAL) {
+					caStatus[i] = status;
+					if (items[i]) items[i]->clearLastPut();
+					std::snprintf(msg, sizeof(msg), "ca_array_put_callback failed after %.3f ms. %s", latencyMs, ca_message_safe(status));
+					ctx.setErrorAt(i, (uInt32)status, msg);
 				}
-				else if (needsUpdate) {
-					ctx.setErrorAt(i, (uInt32)caStatus[i], "ca_array_put failed. " + std::string(ca_message_safe(caStatus[i])));
+				else {
+					std::snprintf(msg, sizeof(msg), "%s (confirmed after %.3f ms)", ca_message_safe(ECA_NORMAL), latencyMs);
+					ctx.setErrorAt(i, (uInt32)ECA_NORMAL, msg);
 				}
-				};
-			if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); updateError(); }
-			else { updateError(); }
-
-			if (CommunicationStatus) {
-				*CommunicationStatus = (caStatus[i] != ECA_NORMAL);
 			}
+			};
+		if (putCtx) {
+			if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); reportCompletion(); }
+			else { reportCompletion(); }
 		}
-		else if (isChar || isShort || isLong32 || isQuad64) {
-			if (!LongValueArray2D || !*LongValueArray2D) {
-				ctx.setErrorAt(i, (uInt32)ECA_BADCOUNT, "Missing LongValueArray2D"); caStatus[i] = ECA_BADCOUNT;
-				if (CommunicationStatus) *CommunicationStatus = 1;
-				continue;
+		if (putCtx && putCtx->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			delete putCtx;
+			putCtx = nullptr;
+		}
+		putCtx = nullptr;
+		putCallbacksTimedOut = callbacksTimedOut;
+	}
+
+	// putValueVerify: wait until the monitored value of every written PV matches what was
+	// written (within the tolerance), then return the readback of all PVs.
+	if (verify) {
+		std::vector<uint8_t> matched(nameCount, 0);
+		auto readbackMatches = [&](uInt32 i) -> bool {
+			PVItem* p = items[i];
+			if (!p) return false;
+			std::lock_guard<std::mutex> lk(p->ioMutex());
+			if (!p->hasValue()) return false;
+			if (!expectedStrings[i].empty()) {
+				const std::vector<std::string> current = p->dbrValue2String();
+				return current.size() >= expectedStrings[i].size()
+					&& std::equal(expectedStrings[i].begin(), expectedStrings[i].end(), current.begin());
+			}
+			const std::vector<double>& expected = expectedNumbers[i];
+			std::vector<double>& current = t_putScratch.monitored;
+			if (current.size() < expected.size()) current.resize(expected.size());
+			if (p->dbrValue2Double(current.data(), static_cast<uInt32>(expected.size())) != expected.size()) return false;
+			for (size_t j = 0; j < expected.size(); ++j) {
+				if (!(std::fabs(current[j] - expected[j]) <= verify->tolerance)) return false;
 			}
-			const uInt32 nToWrite = std::min<unsigned>(availableCount, elementCapacity ? elementCapacity : availableCount);
-			const uint64_t* basePtr = &((**LongValueArray2D)->elt[startIndex]);
+			return true;
+			};
+		const auto verifyDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
+		for (;;) {
+			bool allMatched = true;
+			for (uInt32 i = 0; i < nameCount; ++i) {
+				if (matched[i] || caStatus[i] != ECA_NORMAL) continue;
+				matched[i] = readbackMatches(i) ? 1 : 0;
+				allMatched = allMatched && matched[i];
+			}
+			if (allMatched || std::chrono::steady_clock::now() >= verifyDeadline) break;
+			// valueChanged notifies Globals after every monitor update.
+			Globals::getInstance().waitForNotification(std::chrono::milliseconds(10));
+		}
 
-			auto decodeSigned = [&](uint64_t raw) -> int64_t {
-				if (isChar)   return static_cast<int64_t>(static_cast<int8_t>(raw & 0xFFu));
-				if (isShort)  return static_cast<int64_t>(static_cast<int16_t>(raw & 0xFFFFu));
-				if (isLong32) return static_cast<int64_t>(static_cast<int32_t>(raw & 0xFFFFFFFFu));
-				return static_cast<int64_t>(raw);
-				};
+		auto reportVerification = [&]() {
+			char msg[128];
+			for (uInt32 i = 0; i < nameCount; ++i) {
+				if (caStatus[i] != ECA_NORMAL || matched[i]) continue;
+				caStatus[i] = ECA_TIMEOUT;
+				std::snprintf(msg, sizeof(msg), "Readback did not match the written value within %.0f ms", Timeout * 1000.0);
+				ctx.setErrorAt(i, (uInt32)ECA_TIMEOUT, msg);
+			}
+			};
+		if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); reportVerification(); }
+		else { reportVerification(); }
 
-			if (nativeType == DBF_STRING) {
-				std::vector<dbr_string_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) {
-					std::string s = std::to_string(decodeSigned(basePtr[j]));
-					strncpy(temp[j], s.c_str(), sizeof(dbr_string_t) - 1);
-					temp[j][sizeof(dbr_string_t) - 1] = '\0';
+		bool resized = false;
+		if (resizeNumericArray1D(uB, verify->verified, nameCount, resized) == noErr && verify->verified && *verify->verified) {
+			for (uInt32 i = 0; i < nameCount; ++i) (**verify->verified)->elt[i] = matched[i];
+		}
+		sDoubleArray2DHdl* readback = verify->readbackArray;
+		if (readback) {
+			uInt32 cols = 1;
+			for (uInt32 i = 0; i < nameCount; ++i) {
+				cols = std::max<uInt32>(cols, static_cast<uInt32>(std::max(expectedNumbers[i].size(), expectedStrings[i].size())));
+			}
+			if (!*readback || !**readback || (**readback)->dimSizes[0] != nameCount || (**readback)->dimSizes[1] != cols) {
+				if (NumericArrayResize(fD, 2, (UHandle*)readback, static_cast<size_t>(nameCount) * cols) == noErr && *readback) {
+					(**readback)->dimSizes[0] = nameCount;
+					(**readback)->dimSizes[1] = cols;
+				}
+			}
+			if (*readback && **readback && (**readback)->dimSizes[0] == nameCount && (**readback)->dimSizes[1] == cols) {
+				for (uInt32 i = 0; i < nameCount; ++i) {
+					double* row = (**readback)->elt + static_cast<size_t>(i) * cols;
+					uInt32 copied = 0;
+					if (PVItem* p = items[i]) {
+						std::lock_guard<std::mutex> lk(p->ioMutex());
+						if (p->hasValue()) copied = p->dbrValue2Double(row, cols);
+					}
+					for (uInt32 j = copied; j < cols; ++j) row[j] = std::numeric_limits<double>::quiet_NaN();
 				}
-				caStatus[i] = ctx.doPut(DBR_STRING, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
 			}
-			else if (nativeType == DBF_SHORT) {
-				std::vector<dbr_short_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_short_t>(std::max<int64_t>(std::numeric_limits<dbr_short_t>::min(), std::min<int64_t>(std::numeric_limits<dbr_short_t>::max(), decodeSigned(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_SHORT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+		}
+	}
+
+	// Finalize status.
+	int errorCount = 0;
+	for (uInt32 i = 0; i < nameCount; ++i) {
+		if (caStatus[i] == ECA_NORMAL) continue;
+		++errorCount;
+	}
+	if (putCallbacksTimedOut) {
+		++errorCount;
+	}
+	if (CommunicationStatus && errorCount) {
+		*CommunicationStatus = 1;
+	}
+	if (FirstCall && *FirstCall) *FirstCall = 0;
+}
+
+namespace {
+	// Per-PV state of an asynchronous put job.
+	enum class AsyncPutState : unsigned char { Waiting, Issued, Failed };
+
+	// One putValueAsync call: a private copy of names and values plus per-PV progress.
+	// Fields other than the PutCtx slots are guarded by AsyncPutWriter::mtx.
+	struct AsyncPutJob {
+		uInt32 token = 0;
+		uInt32 dataType = DT_DOUBLE;
+		uInt32 rows = 0;
+		uInt32 cols = 0;
+		std::vector<std::string> names;
+		std::vector<double> doubles;
+		std::vector<uint64_t> longs;
+		std::vector<std::string> strings;
+		std::chrono::steady_clock::time_point deadline;
+		std::vector<AsyncPutState> state;
+		std::vector<int> caStatus;
+		PutCtx* putCtx = nullptr;
+		bool expired = false;
+
+		explicit AsyncPutJob(uInt32 n) : state(n, AsyncPutState::Waiting), caStatus(n, ECA_NORMAL), putCtx(new PutCtx(n)) {}
+		~AsyncPutJob() {
+			// Callbacks still in flight hold their own reference.
+			if (putCtx && putCtx->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				delete putCtx;
 			}
-			else if (nativeType == DBF_FLOAT) {
-				std::vector<dbr_float_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_float_t>(decodeSigned(basePtr[j]));
-				caStatus[i] = ctx.doPut(DBR_FLOAT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			putCtx = nullptr;
+		}
+
+		// True when every put has either failed, been confirmed, or run past the deadline.
+		bool finished() const {
+			if (expired) return true;
+			for (size_t i = 0; i < state.size(); ++i) {
+				if (state[i] == AsyncPutState::Waiting) return false;
+				if (state[i] == AsyncPutState::Issued && putCtx->slots[i].status.load(std::memory_order_acquire) == kPutPending) return false;
 			}
-			else if (nativeType == DBF_ENUM) {
-				std::vector<dbr_enum_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_enum_t>(std::max<int64_t>(0, std::min<int64_t>(std::numeric_limits<dbr_enum_t>::max(), decodeSigned(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_ENUM, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			return true;
+		}
+	};
+
+	// Writer thread behind putValueAsync. Jobs are queued by the caller and processed here:
+	// channels are created, each put is issued as soon as its PV connects, and completion is
+	// tracked through put callbacks, so the LabVIEW caller never waits on an IOC.
+	class AsyncPutWriter {
+	public:
+		// Jobs kept for putValueAsyncResult; the oldest are dropped beyond this.
+		static constexpr size_t kMaxJobs = 1024;
+		// Results nobody collected are dropped this long after the job's deadline.
+		static constexpr std::chrono::seconds kResultRetention{ 60 };
+
+		uInt32 enqueue(std::shared_ptr<AsyncPutJob> job) {
+			ensureStarted();
+			uInt32 token = 0;
+			{
+				std::lock_guard<std::mutex> lk(mtx);
+				if (++nextToken == 0) ++nextToken;
+				token = nextToken;
+				job->token = token;
+				trim(std::chrono::steady_clock::now());
+				jobs[job->token] = job;
+				queue.push_back(std::move(job));
 			}
-			else if (nativeType == DBF_CHAR) {
-				std::vector<dbr_char_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_char_t>(static_cast<uint8_t>(decodeSigned(basePtr[j])));
-				caStatus[i] = ctx.doPut(DBR_CHAR, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			cv.notify_one();
+			return token;
+		}
+
+		std::shared_ptr<AsyncPutJob> find(uInt32 token) {
+			std::lock_guard<std::mutex> lk(mtx);
+			auto it = jobs.find(token);
+			return (it != jobs.end()) ? it->second : nullptr;
+		}
+
+		void forget(uInt32 token) {
+			std::lock_guard<std::mutex> lk(mtx);
+			jobs.erase(token);
+		}
+
+		std::mutex mtx;
+
+	private:
+		std::condition_variable cv;
+		std::deque<std::shared_ptr<AsyncPutJob>> queue;
+		std::map<uInt32, std::shared_ptr<AsyncPutJob>> jobs;
+		uInt32 nextToken = 0;
+		std::thread thread;
+		std::mutex startMtx;
+		std::atomic<bool> started{ false };
+		std::atomic<bool> stopRequested{ false };
+
+		// Drops uncollected results past their retention and, at kMaxJobs, the job with the
+		// earliest deadline, so fire-and-forget callers cannot grow the map (caller holds mtx).
+		// A dropped job that is still active lives on in the writer; only its token is forgotten.
+		void trim(std::chrono::steady_clock::time_point now) {
+			for (auto it = jobs.begin(); it != jobs.end();) {
+				if (now >= it->second->deadline + kResultRetention) it = jobs.erase(it);
+				else ++it;
+			}
+			if (jobs.size() < kMaxJobs) return;
+			auto oldest = jobs.begin();
+			for (auto it = jobs.begin(); it != jobs.end(); ++it) {
+				if (it->second->deadline < oldest->second->deadline) oldest = it;
+			}
+			jobs.erase(oldest);
+		}
+
+		void ensureStarted() {
+			if (started.load()) return;
+			std::lock_guard<std::mutex> lock(startMtx);
+			if (started.load()) return;
+			stopRequested.store(false);
+			thread = std::thread([this] { run(); });
+			started.store(true);
+			Globals::getInstance().registerBackgroundWorker("asyncPutWriter", [this] { stop(); });
+		}
+
+		void stop() {
+			{
+				std::lock_guard<std::mutex> lk(mtx);
+				stopRequested.store(true);
 			}
-			else if (nativeType == DBF_DOUBLE) {
-				std::vector<dbr_double_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_double_t>(decodeSigned(basePtr[j]));
-				caStatus[i] = ctx.doPut(DBR_DOUBLE, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			cv.notify_all();
+			if (thread.joinable()) thread.join();
+			std::lock_guard<std::mutex> lk(mtx);
+			queue.clear();
+			started.store(false);
+		}
+
+		// Creates missing registry entries and starts connecting the job's PVs.
+		void resolve(const AsyncPutJob& job) {
+			Globals& g = Globals::getInstance();
+			TimeoutUniqueLock<std::shared_timed_mutex> lock(g.pvRegistryLock, "putValueAsync", std::chrono::milliseconds(500));
+			if (!lock.isLocked()) {
+				CaLabDbgPrintf("putValueAsync: Failed to acquire pvRegistryLock");
+				return;
 			}
-			else {
-				std::vector<dbr_long_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_long_t>(std::max<int64_t>(std::numeric_limits<dbr_long_t>::min(), std::min<int64_t>(std::numeric_limits<dbr_long_t>::max(), decodeSigned(basePtr[j]))));
-				caStatus[i] = ctx.doPut(DBR_LONG, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-			}
-
-			auto updateError = [&]() {
-				const bool handleOk = (ErrorArray && *ErrorArray && (**ErrorArray) && i < (**ErrorArray)->dimSize);
-				bool needsUpdate = true;
-				if (handleOk) {
-					sError& e = (**ErrorArray)->result[i];
-					const uInt32 lvCode = (caStatus[i] <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(caStatus[i]) + ERROR_OFFSET;
-					if (e.code == lvCode && e.source && *e.source && (*e.source)->cnt > 0) {
-						needsUpdate = false;
-					}
+			for (const auto& name : job.names) {
+				if (name.empty()) continue;
+				PVItem* pvItem = nullptr;
+				auto it = g.pvRegistry.find(name);
+				if (it == g.pvRegistry.end()) {
+					auto newPvItem = std::make_unique<PVItem>(name);
+					pvItem = newPvItem.get();
+					g.pvRegistry[name] = std::move(newPvItem);
+					g.seedFromMetadataCache(pvItem);
 				}
-				if (caStatus[i] == ECA_NORMAL) {
-					ctx.setErrorAt(i, (uInt32)ECA_NORMAL, std::string(ca_message_safe(ECA_NORMAL)));
+				else {
+					pvItem = it->second.get();
 				}
-				else if (needsUpdate) {
-					ctx.setErrorAt(i, (uInt32)caStatus[i], "ca_array_put failed. " + std::string(ca_message_safe(caStatus[i])));
+				if (pvItem && !pvItem->isConnected()) {
+					connectPv(pvItem, /*connectRtyp=*/false);
 				}
-				};
-			if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); updateError(); }
-			else { updateError(); }
-
-			if (CommunicationStatus) {
-				*CommunicationStatus = (caStatus[i] != ECA_NORMAL);
 			}
 		}
-		else if (isString) {
-			if (!StringValueArray2D || !*StringValueArray2D) {
-				ctx.setErrorAt(i, (uInt32)ECA_BADCOUNT, "Missing StringValueArray2D"); caStatus[i] = ECA_BADCOUNT;
-				if (CommunicationStatus) *CommunicationStatus = 1;
-				continue;
-			}
+
+		// Issues the put of PV i; returns the CA status (ECA_NORMAL when issued).
+		int issue(AsyncPutJob& job, uInt32 i, PVItem* item, uInt32& totalWrites) {
+			const uInt32 nameCount = static_cast<uInt32>(job.names.size());
+			const chid channelID = item->channelId;
+			const unsigned elementCapacity = ca_element_count(channelID);
+			const short nativeType = item->getDbrType();
+
+			uInt32 availableCount = 1;
+			size_t startIndex = 0;
+			putSourceRange(i, nameCount, job.rows, job.cols, availableCount, startIndex);
 			const uInt32 nToWrite = std::min<unsigned>(availableCount, elementCapacity ? elementCapacity : availableCount);
 
-			if (nativeType == DBF_STRING) {
-				std::vector<dbr_string_t> temp(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) {
-					std::string s = PutValueCtx::getLVString((**StringValueArray2D)->elt[startIndex + j]);
-					strncpy(temp[j], s.c_str(), sizeof(dbr_string_t) - 1);
-					temp[j][sizeof(dbr_string_t) - 1] = '\0';
-				}
-				caStatus[i] = ctx.doPut(DBR_STRING, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
+			chtype dbrType = DBR_DOUBLE;
+			const void* data = nullptr;
+			uInt32 count = nToWrite;
+			switch (job.dataType) {
+			case DT_SINGLE:
+			case DT_DOUBLE:
+				if (startIndex + nToWrite > job.doubles.size()) return ECA_BADCOUNT;
+				data = convertForPut<double>(job.doubles.data() + startIndex, nToWrite, nativeType, dbrType);
+				break;
+			case DT_CHAR:
+			case DT_SHORT:
+			case DT_LONG:
+			case DT_QUAD:
+				if (startIndex + nToWrite > job.longs.size()) return ECA_BADCOUNT;
+				data = convertIntegersForPut(job.longs.data() + startIndex, nToWrite, nativeType, dbrType,
+					job.dataType == DT_CHAR, job.dataType == DT_SHORT, job.dataType == DT_LONG);
+				break;
+			case DT_STRING: {
+				if (startIndex + nToWrite > job.strings.size()) return ECA_BADCOUNT;
+				const std::string* strings = job.strings.data() + startIndex;
+				auto jobText = [strings](uInt32 j, const char*& text, size_t& len) {
+					text = strings[j].c_str();
+					len = strings[j].size();
+					};
+				data = convertStringsForPut(jobText, nToWrite, nativeType, elementCapacity, dbrType, count);
+				if (!data) return ECA_BADTYPE;
+				break;
 			}
-			else if (nativeType == DBF_CHAR) {
-				std::string s = PutValueCtx::getLVString((**StringValueArray2D)->elt[startIndex]);
-				uInt32 count = (uInt32)std::min<size_t>(elementCapacity ? elementCapacity : s.size(), s.size());
-				if (count == 0) { dbr_char_t zero = 0; caStatus[i] = ctx.doPut(DBR_CHAR, 1, channelID, &zero, doWaitRequested, putCtx, totalWrites); }
-				else { caStatus[i] = ctx.doPut(DBR_CHAR, count, channelID, s.c_str(), doWaitRequested, putCtx, totalWrites); }
+			default:
+				return ECA_BADTYPE;
 			}
-			else {
-				bool allOk = true;
-				std::vector<double> numericValues(nToWrite);
-				for (uInt32 j = 0; j < nToWrite; ++j) {
-					std::string s = PutValueCtx::getLVString((**StringValueArray2D)->elt[startIndex + j]);
-					if (!PutValueCtx::parseNumericString(s, numericValues[j])) { allOk = false; break; }
-				}
-				if (!allOk) { ctx.setErrorAt(i, (uInt32)ECA_BADTYPE, "Invalid numeric string(s)"); caStatus[i] = ECA_BADTYPE; continue; }
-
-				if (nativeType == DBF_DOUBLE) {
-					std::vector<dbr_double_t> temp(nToWrite);
-					for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_double_t>(numericValues[j]);
-					caStatus[i] = ctx.doPut(DBR_DOUBLE, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-				}
-				else if (nativeType == DBF_FLOAT) {
-					std::vector<dbr_float_t> temp(nToWrite);
-					for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_float_t>(numericValues[j]);
-					caStatus[i] = ctx.doPut(DBR_FLOAT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-				}
-				else if (nativeType == DBF_SHORT) {
-					std::vector<dbr_short_t> temp(nToWrite);
-					for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_short_t>(std::max<long long>(std::numeric_limits<dbr_short_t>::min(), std::min<long long>(std::numeric_limits<dbr_short_t>::max(), static_cast<long long>(numericValues[j]))));
-					caStatus[i] = ctx.doPut(DBR_SHORT, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-				}
-				else if (nativeType == DBF_ENUM) {
-					std::vector<dbr_enum_t> temp(nToWrite);
-					for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_enum_t>(std::max<long long>(0, std::min<long long>(std::numeric_limits<dbr_enum_t>::max(), static_cast<long long>(numericValues[j]))));
-					caStatus[i] = ctx.doPut(DBR_ENUM, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-				}
-				else if (nativeType == DBF_LONG) {
-					std::vector<dbr_long_t> temp(nToWrite);
-					for (uInt32 j = 0; j < nToWrite; ++j) temp[j] = static_cast<dbr_long_t>(std::max<long long>(std::numeric_limits<dbr_long_t>::min(), std::min<long long>(std::numeric_limits<dbr_long_t>::max(), static_cast<long long>(numericValues[j]))));
-					caStatus[i] = ctx.doPut(DBR_LONG, nToWrite, channelID, temp.data(), doWaitRequested, putCtx, totalWrites);
-				}
-			}
-
-			auto updateError = [&]() {
-				const bool handleOk = (ErrorArray && *ErrorArray && (**ErrorArray) && i < (**ErrorArray)->dimSize);
-				bool needsUpdate = true;
-				if (handleOk) {
-					sError& e = (**ErrorArray)->result[i];
-					const uInt32 lvCode = (caStatus[i] <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(caStatus[i]) + ERROR_OFFSET;
-					if (e.code == lvCode && e.source && *e.source && (*e.source)->cnt > 0) {
-						needsUpdate = false;
-					}
+			return issuePut(i, dbrType, count, channelID, data, job.putCtx, totalWrites, item);
+		}
+
+		// Issues all puts whose PVs are connected by now; returns true once nothing is left waiting.
+		bool progress(AsyncPutJob& job) {
+			Globals& g = Globals::getInstance();
+			const bool pastDeadline = std::chrono::steady_clock::now() >= job.deadline;
+			TimeoutSharedLock<std::shared_timed_mutex> rlock(g.pvRegistryLock, "putValueAsync-issue", std::chrono::milliseconds(50));
+			if (!rlock.isLocked()) {
+				return false;
+			}
+			std::lock_guard<std::mutex> lk(mtx);
+			bool waiting = false;
+			uInt32 totalWrites = 0;
+			for (uInt32 i = 0; i < job.names.size(); ++i) {
+				if (job.state[i] != AsyncPutState::Waiting) continue;
+				auto it = g.pvRegistry.find(job.names[i]);
+				PVItem* item = (it != g.pvRegistry.end()) ? it->second.get() : nullptr;
+				if (item && item->channelId && item->isConnected()) {
+					const int rc = issue(job, i, item, totalWrites);
+					job.caStatus[i] = rc;
+					job.state[i] = (rc == ECA_NORMAL) ? AsyncPutState::Issued : AsyncPutState::Failed;
+				}
+				else if (pastDeadline || job.names[i].empty()) {
+					job.caStatus[i] = ECA_DISCONNCHID;
+					job.state[i] = AsyncPutState::Failed;
+				}
+				else {
+					waiting = true;
 				}
-				if (caStatus[i] == ECA_NORMAL) {
-					ctx.setErrorAt(i, (uInt32)ECA_NORMAL, std::string(ca_message_safe(ECA_NORMAL)));
+			}
+			if (totalWrites) ca_flush_io();
+			return !waiting;
+		}
+
+		void run() {
+			CaContextGuard _caThreadAttach;
+			std::vector<std::shared_ptr<AsyncPutJob>> active;
+			while (!stopRequested.load()) {
+				std::vector<std::shared_ptr<AsyncPutJob>> incoming;
+				{
+					std::unique_lock<std::mutex> lk(mtx);
+					// Poll connections at a short interval while puts are still waiting for them.
+					if (active.empty()) {
+						cv.wait(lk, [this] { return stopRequested.load() || !queue.empty(); });
+					}
+					else {
+						cv.wait_for(lk, std::chrono::milliseconds(10), [this] { return stopRequested.load() || !queue.empty(); });
+					}
+					if (stopRequested.load()) break;
+					incoming.assign(queue.begin(), queue.end());
+					queue.clear();
 				}
-				else if (needsUpdate) {
-					ctx.setErrorAt(i, (uInt32)caStatus[i], "ca_array_put failed. " + std::string(ca_message_safe(caStatus[i])));
+				for (auto& job : incoming) {
+					resolve(*job);
+					active.push_back(std::move(job));
 				}
-				};
-			if (instanceData) { std::lock_guard<std::mutex> lock(instanceData->arrayMutex); updateError(); }
-			else { updateError(); }
+				if (!incoming.empty()) ca_flush_io();
 
-			if (CommunicationStatus) {
-				*CommunicationStatus = (caStatus[i] != ECA_NORMAL);
+				for (size_t k = 0; k < active.size();) {
+					if (progress(*active[k])) {
+						active[k] = std::move(active.back());
+						active.pop_back();
+					}
+					else {
+						++k;
+					}
+				}
 			}
 		}
+	};
+
+	AsyncPutWriter g_asyncPutWriter;
+}
+
+extern "C" EXPORT void putValueAsync(sStringArrayHdl* PvNameArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, uInt32* Token) {
+	if (Token) *Token = 0;
+	if (PvNameArray == nullptr || *PvNameArray == nullptr || DSCheckHandle(*PvNameArray) != noErr || (**PvNameArray)->dimSize == 0) {
+		return;
 	}
-	ca_poll();
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) return;
 
-	// If using callbacks, wait for all write callbacks to complete.
-	if (doWaitRequested) {
-		bool callbacksTimedOut = false;
-		if (totalWrites > 0) {
-			const auto writeDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
-			while (std::chrono::steady_clock::now() < writeDeadline && putCtx->completed.load(std::memory_order_relaxed) < totalWrites) {
-				ca_pend_event(0.02);
-				Globals::getInstance().waitForNotification(std::chrono::milliseconds(10));
-			}
-			if (putCtx->completed.load(std::memory_order_relaxed) < totalWrites) {
-				callbacksTimedOut = true;
+	const uInt32 nameCount = static_cast<uInt32>((**PvNameArray)->dimSize);
+	auto job = std::make_shared<AsyncPutJob>(nameCount);
+	job->dataType = DataType;
+	job->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
+	job->names.reserve(nameCount);
+	for (uInt32 i = 0; i < nameCount; ++i) {
+		LStrHandle h = (**PvNameArray)->elt[i];
+		job->names.emplace_back((h && *h) ? std::string(reinterpret_cast<const char*>((*h)->str), static_cast<size_t>((*h)->cnt)) : std::string());
+	}
+
+	// Copy the values: the LabVIEW handles are only valid for the duration of this call.
+	switch (DataType) {
+	case DT_SINGLE:
+	case DT_DOUBLE:
+		if (!DoubleValueArray2D || !*DoubleValueArray2D) return;
+		job->rows = (**DoubleValueArray2D)->dimSizes[0];
+		job->cols = (**DoubleValueArray2D)->dimSizes[1];
+		job->doubles.assign((**DoubleValueArray2D)->elt, (**DoubleValueArray2D)->elt + static_cast<size_t>(job->rows) * job->cols);
+		break;
+	case DT_CHAR:
+	case DT_SHORT:
+	case DT_LONG:
+	case DT_QUAD:
+		if (!LongValueArray2D || !*LongValueArray2D) return;
+		job->rows = (**LongValueArray2D)->dimSizes[0];
+		job->cols = (**LongValueArray2D)->dimSizes[1];
+		job->longs.assign((**LongValueArray2D)->elt, (**LongValueArray2D)->elt + static_cast<size_t>(job->rows) * job->cols);
+		break;
+	case DT_STRING: {
+		if (!StringValueArray2D || !*StringValueArray2D) return;
+		job->rows = (**StringValueArray2D)->dimSizes[0];
+		job->cols = (**StringValueArray2D)->dimSizes[1];
+		const size_t n = static_cast<size_t>(job->rows) * job->cols;
+		job->strings.reserve(n);
+		for (size_t k = 0; k < n; ++k) {
+			LStrHandle h = (**StringValueArray2D)->elt[k];
+			job->strings.emplace_back((h && *h) ? std::string(reinterpret_cast<const char*>((*h)->str), static_cast<size_t>((*h)->cnt)) : std::string());
+		}
+		break;
+	}
+	default:
+		return;
+	}
+	if (job->rows && job->rows != nameCount && job->rows != 1) {
+		CaLabDbgPrintf("putValueAsync: Value array rows must match PV count or be 1");
+		return;
+	}
+
+	const uInt32 token = g_asyncPutWriter.enqueue(std::move(job));
+	if (Token) *Token = token;
+}
+
+extern "C" EXPORT void putValueAsyncResult(uInt32 Token, double Timeout, sUInt32ArrayHdl* ErrorCode, sDoubleArrayHdl* LatencyMs, LVBoolean* Done) {
+	if (Done) *Done = 0;
+	Globals& g = Globals::getInstance();
+	std::shared_ptr<AsyncPutJob> job = g_asyncPutWriter.find(Token);
+	if (!job) {
+		// Unknown, already collected or evicted token.
+		if (Done) *Done = 1;
+		return;
+	}
+
+	// putCompleted() notifies Globals, so completions wake this wait without polling CA.
+	const auto waitDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(static_cast<int>(Timeout * 1000.0));
+	bool finished = false;
+	for (;;) {
+		{
+			std::lock_guard<std::mutex> lk(g_asyncPutWriter.mtx);
+			if (!job->expired && std::chrono::steady_clock::now() >= job->deadline) {
+				// The writer fails PVs that never connected; issued puts without callback count as timed out.
+				bool waiting = false;
+				for (auto s : job->state) waiting = waiting || (s == AsyncPutState::Waiting);
+				job->expired = !waiting;
 			}
+			finished = job->finished();
 		}
-		if (putCtx && putCtx->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-			delete putCtx;
-			putCtx = nullptr;
-		}
-		putCtx = nullptr;
-		putCallbacksTimedOut = callbacksTimedOut;
+		if (finished || g.stopped.load() || std::chrono::steady_clock::now() >= waitDeadline) break;
+		g.waitForNotification(std::chrono::milliseconds(10));
 	}
 
-	// Finalize status.
-	int errorCount = 0;
-	for (uInt32 i = 0; i < nameCount; ++i) {
-		if (caStatus[i] == ECA_NORMAL) continue;
-		++errorCount;
+	const uInt32 nameCount = static_cast<uInt32>(job->names.size());
+	bool resized = false;
+	if (resizeNumericArray1D(uL, ErrorCode, nameCount, resized) != noErr || resizeNumericArray1D(fD, LatencyMs, nameCount, resized) != noErr) {
+		CaLabDbgPrintf("putValueAsyncResult: Error preparing output arrays");
+		return;
 	}
-	if (putCallbacksTimedOut) {
-		++errorCount;
+	uInt32* errOut = (ErrorCode && *ErrorCode) ? (**ErrorCode)->elt : nullptr;
+	double* latOut = (LatencyMs && *LatencyMs) ? (**LatencyMs)->elt : nullptr;
+	{
+		std::lock_guard<std::mutex> lk(g_asyncPutWriter.mtx);
+		for (uInt32 i = 0; i < nameCount; ++i) {
+			int status = kPutPending;
+			double latencyMs = -1.0;
+			if (job->state[i] == AsyncPutState::Failed) {
+				status = job->caStatus[i];
+			}
+			else if (job->state[i] == AsyncPutState::Issued) {
+				const PutSlot& slot = job->putCtx->slots[i];
+				status = slot.status.load(std::memory_order_acquire);
+				if (status != kPutPending) {
+					latencyMs = slot.latencyUs.load(std::memory_order_relaxed) / 1000.0;
+				}
+				else if (job->expired) {
+					status = ECA_TIMEOUT;
+				}
+			}
+			if (status == kPutPending) {
+				// Not yet connected or confirmed: distinct from success (0).
+				status = ECA_IOINPROGRESS;
+			}
+			if (errOut) errOut[i] = (status <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(status) + ERROR_OFFSET;
+			if (latOut) latOut[i] = latencyMs;
+		}
 	}
-	if (CommunicationStatus && errorCount) {
-		*CommunicationStatus = 1;
+	if (finished) {
+		g_asyncPutWriter.forget(Token);
 	}
-	if (FirstCall && *FirstCall) *FirstCall = 0;
+	if (Done) *Done = finished ? 1 : 0;
 }
 
 extern "C" EXPORT void info(sStringArray2DHdl* InfoStringArray2D, sResultArrayHdl* ResultArray, LVBoolean* FirstCall) {
@@ -1975,7 +3105,9 @@ extern "C" EXPORT void disconnectPVs(sStringArrayHdl* PvNameArray, bool All) {
 			ev = item->eventId;
 			ch = item->channelId;
 			item->eventId = nullptr;
+			item->propertyEventId = nullptr; // removed together with the channel
 			item->channelId = nullptr;
+			item->clearStaticFetchIssued();
 
 			// Internal status: disconnected and data released.
 			item->setConnected(false);
@@ -2129,7 +3261,7 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 		// === CRITICAL: Collect and reset PVs BEFORE cleaning up arrays ===
 		// This must happen for getValue AND putValue instances
 		std::vector<PVItem*> pvsToReset;
-		if (data->firstFunctionName == "getValue" || data->firstFunctionName == "putValue") {
+		if (data->firstFunctionName == "getValue" || data->firstFunctionName == "getValueDoubles" || data->firstFunctionName == "getValueMetadata" || data->firstFunctionName == "putValue") {
 			// Phase 1: Collect base PVs from PvIndexArray BEFORE it gets cleared
 			std::vector<PVItem*> basePvs;
 			{
@@ -2322,11 +3454,14 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 							info.ch = pvItem->channelId;
 
 							pvItem->eventId = nullptr;
+							pvItem->propertyEventId = nullptr;
 							pvItem->channelId = nullptr;
 							pvItem->setConnected(false);
 							pvItem->setHasValue(false);
 							pvItem->setRecordType("");
 							pvItem->clearEnumFetchRequested();
+							pvItem->clearPollGetInFlight();
+							pvItem->clearStaticFetchIssued();
 						}
 
 						resetInfos.emplace_back(std::move(info));
@@ -2354,7 +3489,7 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 		if (!skipCleanup) {
 			// NOW clean up arrays owned by this instance (AFTER PV reset)
 			// Collect & atomically claim entries while the array buffer is still valid.
-			std::vector<PvIndexEntry*> entriesToDelete;
+			std::vector<uintptr_t> entriesToDelete;
 			{
 				std::lock_guard<std::mutex> lk(data->arrayMutex);
 
@@ -2376,7 +3511,7 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 								else {
 									entriesToDelete.reserve(arr->dimSize);
 									for (uInt64 i = 0; i < arr->dimSize; ++i) {
-										// Interpret the LabVIEW slot as an atomic pointer-sized integer.
+										// Interpret the LabVIEW slot as an atomic pointer-sized integer (entry token).
 										atomic_ptr_t* atomicElt = reinterpret_cast<atomic_ptr_t*>(&arr->elt[i]);
 										uintptr_t raw = atomicElt->load(std::memory_order_acquire);
 										if (raw == 0) continue;
@@ -2384,12 +3519,11 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 										uintptr_t expected = raw;
 										// Claim the slot by CAS while the array memory is still valid.
 										if (atomicElt->compare_exchange_strong(expected, 0, std::memory_order_acq_rel, std::memory_order_acquire)) {
-											// Successfully claimed the slot; keep the entry pointer for later deletion.
-											PvIndexEntry* entry = reinterpret_cast<PvIndexEntry*>(raw);
-											if (entry) {
+											// Successfully claimed the slot; keep the token for later deletion.
+											if (PvEntrySlots::liveSlot(raw)) {
 												// Mark deleting to prevent further acquirers (defensive).
-												entry->mark_deleting();
-												entriesToDelete.push_back(entry);
+												PvEntrySlots::markDeleting(raw);
+												entriesToDelete.push_back(raw);
 											}
 										}
 									}
@@ -2409,35 +3543,14 @@ extern "C" EXPORT MgErr unreserved(InstanceDataPtr* instanceState) {
 				data->PvIndexArray = nullptr;
 			}
 
-			// Helper: plausibility check for pointer-like values.
-			auto isPlausiblePointer = [](uintptr_t p) -> bool {
-				// Reject very small addresses and misaligned pointers.
-				if (p < 0x10000) return false;
-#if (UINTPTR_MAX == 0xffffffff)
-				const uintptr_t align = 4;
-#else
-				const uintptr_t align = 8;
-#endif
-				if ((p & (align - 1)) != 0) return false;
-				return true;
-				};
-
 			// Perform wait + deletion for the claimed entries without holding data->arrayMutex.
 			if (!entriesToDelete.empty()) {
 				const auto hardTimeout = std::chrono::seconds(3);
-				std::vector<PvIndexEntry*> deferred;
-				for (PvIndexEntry* entry : entriesToDelete) {
-					if (!entry) continue;
-
-					const uintptr_t rawAddr = reinterpret_cast<uintptr_t>(entry);
-					if (!isPlausiblePointer(rawAddr)) {
-						CaLabDbgPrintf("unreserved: Implausible entry pointer 0x%016" PRIxPTR " - scheduling deferred deletion", rawAddr);
-						deferred.push_back(entry);
-						continue;
-					}
-
-					if (!tryReclaimAndDelete(entry, hardTimeout)) {
-						deferred.push_back(entry);
+				std::vector<uintptr_t> deferred;
+				for (uintptr_t token : entriesToDelete) {
+					if (!token) continue;
+					if (!tryReclaimAndDelete(token, hardTimeout)) {
+						deferred.push_back(token);
 					}
 				}
 				if (!deferred.empty()) {
@@ -2590,7 +3703,12 @@ extern "C" EXPORT void addEvent(LVUserEventRef* RefNum, sResult* ResultPtr) {
 	// Register the (RefNum, ResultPtr) pair for this PV.
 	{
 		std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
-		g_eventRegistry.map[pvName].emplace_back(*RefNum, ResultPtr);
+		EventSubscription sub;
+		sub.ref = *RefNum;
+		sub.result = ResultPtr;
+		auto rate = g_eventRegistry.intervals.find(*RefNum);
+		if (rate != g_eventRegistry.intervals.end()) sub.minInterval = rate->second;
+		g_eventRegistry.map[pvName].push_back(sub);
 	}
 
 	// If the PV already has a value, post an event immediately.
@@ -2606,10 +3724,10 @@ extern "C" EXPORT void destroyEvent(LVUserEventRef* RefNum) {
 
 	{
 		std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
+		g_eventRegistry.intervals.erase(*RefNum);
 		for (auto it = g_eventRegistry.map.begin(); it != g_eventRegistry.map.end(); ) {
 			auto& vec = it->second;
-			vec.erase(std::remove_if(vec.begin(), vec.end(),
-				[&](const auto& pair) { return pair.first == *RefNum; }), vec.end());
+			eraseSubscriptions(vec, *RefNum);
 
 			if (vec.empty()) {
 				it = g_eventRegistry.map.erase(it);
@@ -2622,34 +3740,49 @@ extern "C" EXPORT void destroyEvent(LVUserEventRef* RefNum) {
 	g.notify();
 }
 
-void postEventForPv(const std::string& pvName) {
-	if (pvName.empty()) return;
+extern "C" EXPORT void setEventRate(LVUserEventRef* RefNum, double MaxRate) {
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load() || !RefNum) return;
 
-	// Locate the PVItem.
-	PVItem* pvItem = nullptr;
-	{
-		std::shared_lock<std::shared_timed_mutex> rlock(Globals::getInstance().pvRegistryLock, std::try_to_lock);
-		if (!rlock.owns_lock()) {
-			Globals::getInstance().enqueueDeferredEvent(pvName);
-			return;
+	const auto interval = (MaxRate > 0.0)
+		? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / MaxRate))
+		: std::chrono::steady_clock::duration::zero();
+	std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
+	if (interval.count() > 0) {
+		g_eventRegistry.intervals[*RefNum] = interval;
+	}
+	else {
+		g_eventRegistry.intervals.erase(*RefNum);
+	}
+	for (auto& kv : g_eventRegistry.map) {
+		for (auto& sub : kv.second) {
+			if (sub.ref == *RefNum) sub.minInterval = interval;
 		}
-		auto it = Globals::getInstance().pvRegistry.find(pvName);
-		if (it == Globals::getInstance().pvRegistry.end() || !it->second) return;
-		pvItem = it->second.get();
 	}
+}
 
-	// Snapshot subscribers to avoid holding the lock during LV calls.
-	std::vector<std::pair<LVUserEventRef, sResult*>> subscribers;
+// Looks up the PVItem an event is posted for without blocking; on registry lock contention the
+// post is deferred to the poll thread.
+static PVItem* findEventPv(const std::string& pvName) {
+	std::shared_lock<std::shared_timed_mutex> rlock(Globals::getInstance().pvRegistryLock, std::try_to_lock);
+	if (!rlock.owns_lock()) {
+		Globals::getInstance().enqueueDeferredEvent(pvName);
+		return nullptr;
+	}
+	auto it = Globals::getInstance().pvRegistry.find(pvName);
+	if (it == Globals::getInstance().pvRegistry.end() || !it->second) return nullptr;
+	return it->second.get();
+}
+
+// Posts the current state of pvItem to the given subscribers; failed registrations are removed.
+static void deliverEvents(const std::string& pvName, PVItem* pvItem, const std::vector<std::pair<LVUserEventRef, sResult*>>& subscribers) {
+	// Convert and format the PV state once; subscribers only get copies of it.
+	thread_local PvResultSnapshot snapshot;
 	{
-		std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
-		auto it = g_eventRegistry.map.find(pvName);
-		if (it != g_eventRegistry.map.end()) {
-			subscribers = it->second;
-		}
+		std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+		snapshotPv(pvItem, snapshot);
 	}
 
-	if (subscribers.empty()) return;
-
 	// Prepare and post an event for each subscriber.
 	for (auto& sub : subscribers) {
 		LVUserEventRef ref = sub.first;
@@ -2657,10 +3790,7 @@ void postEventForPv(const std::string& pvName) {
 		if (!target) continue;
 
 		// Update the target cluster with the current PV state.
-		{
-			std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-			fillResultFromPv(pvItem, target);
-		}
+		fillResultFromSnapshot(snapshot, target);
 
 		// Fire the LabVIEW user event.
 		MgErr postErr = mgNoErr;
@@ -2670,7 +3800,10 @@ void postEventForPv(const std::string& pvName) {
 			CaLabDbgPrintf("postEventForPv: Exception while posting event for %s", pvName.c_str());
 			continue;
 		}
-		if (postErr != mgNoErr) {
+		if (postErr == mgNoErr) {
+			Globals::getInstance().eventsPosted.fetch_add(1, std::memory_order_relaxed);
+		}
+		else {
 			// remove event from registry
 			bool removalFailed = false;
 			{
@@ -2679,8 +3812,7 @@ void postEventForPv(const std::string& pvName) {
 					auto it = g_eventRegistry.map.find(pvName);
 					if (it != g_eventRegistry.map.end()) {
 						auto& vec = it->second;
-						vec.erase(std::remove_if(vec.begin(), vec.end(),
-							[&](const auto& pair) { return pair.first == ref; }), vec.end());
+						eraseSubscriptions(vec, ref);
 						if (vec.empty()) {
 							g_eventRegistry.map.erase(it);
 						}
@@ -2698,6 +3830,98 @@ void postEventForPv(const std::string& pvName) {
 	}
 }
 
+void postDueEvents() {
+	if (g_eventRegistry.pendingCount.load(std::memory_order_relaxed) == 0) return;
+
+	// Serve the queue in order. Once the global budget is spent, the rest keep their place.
+	std::vector<PendingEvent> due;
+	{
+		std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
+		const auto now = std::chrono::steady_clock::now();
+		std::deque<PendingEvent> waiting;
+		bool budgetSpent = false;
+		while (!g_eventRegistry.pendingQueue.empty()) {
+			PendingEvent ev = std::move(g_eventRegistry.pendingQueue.front());
+			g_eventRegistry.pendingQueue.pop_front();
+			auto it = g_eventRegistry.map.find(ev.pvName);
+			if (it == g_eventRegistry.map.end()) continue;
+			auto sub = std::find_if(it->second.begin(), it->second.end(), [&](const EventSubscription& s) {
+				return s.pending && s.ref == ev.ref && s.result == ev.result;
+				});
+			if (sub == it->second.end()) continue;
+			if (budgetSpent || now - sub->lastPost < sub->minInterval) {
+				waiting.push_back(std::move(ev));
+				continue;
+			}
+			if (!takeEventToken(now)) {
+				budgetSpent = true;
+				waiting.push_back(std::move(ev));
+				continue;
+			}
+			sub->pending = false;
+			sub->lastPost = now;
+			g_eventRegistry.pendingCount.fetch_sub(1, std::memory_order_relaxed);
+			due.push_back(std::move(ev));
+		}
+		g_eventRegistry.pendingQueue.swap(waiting);
+	}
+
+	// One snapshot per PV, in queue order of its first due subscription.
+	std::vector<bool> done(due.size(), false);
+	std::vector<std::pair<LVUserEventRef, sResult*>> subscribers;
+	for (size_t i = 0; i < due.size(); ++i) {
+		if (done[i]) continue;
+		subscribers.clear();
+		for (size_t j = i; j < due.size(); ++j) {
+			if (!done[j] && due[j].pvName == due[i].pvName) {
+				subscribers.emplace_back(due[j].ref, due[j].result);
+				done[j] = true;
+			}
+		}
+		if (PVItem* pvItem = findEventPv(due[i].pvName)) {
+			deliverEvents(due[i].pvName, pvItem, subscribers);
+		}
+	}
+}
+
+void postEventForPv(const std::string& pvName) {
+	if (pvName.empty()) return;
+
+	PVItem* pvItem = findEventPv(pvName);
+	if (!pvItem) return;
+
+	// Snapshot subscribers to avoid holding the lock during LV calls. Subscriptions still
+	// inside their interval, or over the global event budget, only remember that an update
+	// is pending. While anything is pending under CALAB_MAX_EVENT_RATE, new updates queue up
+	// behind it instead of taking the tokens postDueEvents hands out in order.
+	std::vector<std::pair<LVUserEventRef, sResult*>> subscribers;
+	{
+		std::lock_guard<std::mutex> lock(g_eventRegistry.mtx);
+		auto it = g_eventRegistry.map.find(pvName);
+		if (it != g_eventRegistry.map.end()) {
+			const auto now = std::chrono::steady_clock::now();
+			const bool budgeted = Globals::getInstance().maxEventRate > 0.0;
+			for (auto& sub : it->second) {
+				if (sub.pending && budgeted) continue;
+				const bool withinInterval = sub.minInterval.count() > 0 && now - sub.lastPost < sub.minInterval;
+				if (withinInterval || (budgeted && (g_eventRegistry.pendingCount.load(std::memory_order_relaxed) > 0 || !takeEventToken(now)))) {
+					markEventPending(pvName, sub);
+					continue;
+				}
+				if (sub.pending) {
+					sub.pending = false;
+					g_eventRegistry.pendingCount.fetch_sub(1, std::memory_order_relaxed);
+				}
+				sub.lastPost = now;
+				subscribers.emplace_back(sub.ref, sub.result);
+			}
+		}
+	}
+
+	if (subscribers.empty()) return;
+	deliverEvents(pvName, pvItem, subscribers);
+}
+
 // =================================================================================
 // Core PV & Channel Access Logic
 // =================================================================================
@@ -2766,6 +3990,8 @@ bool setupPvIndexAndRegistry(sStringArrayHdl* PvNameArray, sStringArrayHdl* Fiel
 	}
 
 	if (PvIndexArray != nullptr && *PvIndexArray != nullptr && **PvIndexArray != nullptr) {
+		// Shared by all entries of this array; PVItems mark their index on every change.
+		auto dirtySet = std::make_shared<PvDirtySet>(nameCount);
 		for (uInt32 i = 0; i < nameCount; ++i) {
 			LStrHandle pvHandle = (**PvNameArray)->elt[i];
 			if (!pvHandle || !*pvHandle || (*pvHandle)->cnt == 0) {
@@ -2802,6 +4028,7 @@ bool setupPvIndexAndRegistry(sStringArrayHdl* PvNameArray, sStringArrayHdl* Fiel
 				auto newPvItem = std::make_unique<PVItem>(pvName);
 				pvItem = newPvItem.get();
 				Globals::getInstance().pvRegistry[pvName] = std::move(newPvItem);
+				Globals::getInstance().seedFromMetadataCache(pvItem);
 				if (uninitializedPvNames) uninitializedPvNames->insert(pvItem->getName());
 			}
 			else {
@@ -2824,11 +4051,16 @@ bool setupPvIndexAndRegistry(sStringArrayHdl* PvNameArray, sStringArrayHdl* Fiel
 							hasStaleChannel = true;
 							// Clear stale CA handles
 							pvItem->eventId = nullptr;
+							pvItem->propertyEventId = nullptr;
 							pvItem->channelId = nullptr;
 							pvItem->setConnected(false);
 							pvItem->setHasValue(false);
-							pvItem->setRecordType(""); // Clear record type to force RTYP fetch
+							pvItem->setRecordType("");
+							// connectPv refills the type from the cache; have it read .RTYP once more.
+							Globals::getInstance().markRecordTypeUnverified(pvItem->getName());
 							pvItem->clearEnumFetchRequested();
+							pvItem->clearPollGetInFlight();
+							pvItem->clearStaticFetchIssued();
 						}
 					}
 
@@ -2858,11 +4090,19 @@ bool setupPvIndexAndRegistry(sStringArrayHdl* PvNameArray, sStringArrayHdl* Fiel
 
 			// Create meta and entry and store atomically in the array
 			auto metaInfo = new PVMetaInfo(pvItem);
-			PvIndexEntry* entry = new PvIndexEntry(pvItem, metaInfo);
+			PvIndexEntry* entry = new PvIndexEntry(pvItem, metaInfo, dirtySet);
+			if (!entry->token()) {
+				CaLabDbgPrintf("Error: PvIndexEntry slot table exhausted for %s.", pvName.c_str());
+				delete metaInfo;
+				delete entry;
+				*CommunicationStatus = 1;
+				continue;
+			}
+			pvItem->addChangeListener(dirtySet, i);
 
-			// Use pointer-sized atomic for portability
+			// Use pointer-sized atomic for portability; the element holds the slot token.
 			auto atomicElt = reinterpret_cast<atomic_ptr_t*>(&(**PvIndexArray)->elt[i]);
-			atomicElt->store(reinterpret_cast<uintptr_t>(entry), std::memory_order_release);
+			atomicElt->store(entry->token(), std::memory_order_release);
 		}
 	}
 	else {
@@ -2874,39 +4114,101 @@ bool setupPvIndexAndRegistry(sStringArrayHdl* PvNameArray, sStringArrayHdl* Fiel
 }
 
 void subscribePv(PVItem* pvItem) {
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) return;
+	// Check and create under ioMutex: connectionChanged (CA thread) and the reader threads can
+	// race here, and only the caller that finds eventId empty may create the monitor.
+	std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+	if (pvItem->eventId != nullptr) {
+		return;
+	}
+	if (pvItem->channelId == nullptr) {
+		pvItem->setErrorCode(ECA_DISCONNCHID);
+		return;
+	}
+	channel_state state = ca_state(pvItem->channelId);
+	if (state != cs_conn) {
+		pvItem->setErrorCode(ECA_DISCONN);
+		return;
+	}
+	g.addPendingConnection(pvItem);
+
+	int requestedDbrType = dbf_type_to_DBR_TIME(pvItem->getDbrType());
+
+	int rc = ca_create_subscription(requestedDbrType, pvItem->getNumberOfValues(), pvItem->channelId, DBE_VALUE | DBE_ALARM, valueChanged, pvItem, &pvItem->eventId);
+	if (rc != ECA_NORMAL) {
+		pvItem->setErrorCode(rc);
+		pvItem->eventId = nullptr;
+		g.removePendingConnection(pvItem);
+		CaLabDbgPrintf("Warning: Could not create subscription for %s. %s", pvItem->getName().c_str(), ca_message_safe(rc));
+	}
+}
+
+void fetchPvOnce(PVItem* pvItem) {
 	Globals& g = Globals::getInstance();
 	if (g.stopped.load()) return;
 	short dbrType;
 	uInt32 numValues;
+	chanId channelId;
 	{
 		std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-		if (pvItem->eventId != nullptr) {
-			return;
-		}
-		if (pvItem->channelId == nullptr) {
-			pvItem->setErrorCode(ECA_DISCONNCHID);
+		if (pvItem->channelId == nullptr || ca_state(pvItem->channelId) != cs_conn) {
 			return;
 		}
-		channel_state state = ca_state(pvItem->channelId);
-		if (state != cs_conn) {
-			pvItem->setErrorCode(ECA_DISCONN);
+		if (!pvItem->tryMarkStaticFetchIssued()) {
 			return;
 		}
 		dbrType = pvItem->getDbrType();
 		numValues = pvItem->getNumberOfValues();
+		channelId = pvItem->channelId;
 	}
 	g.addPendingConnection(pvItem);
 
-	int requestedDbrType = dbf_type_to_DBR_TIME(dbrType);
-
-	int rc = ca_create_subscription(requestedDbrType, numValues, pvItem->channelId, DBE_VALUE | DBE_ALARM, valueChanged, pvItem, &pvItem->eventId);
+	// Completion goes through valueChanged exactly like a monitor update.
+	int rc = ca_array_get_callback(dbf_type_to_DBR_TIME(dbrType), numValues, channelId, valueChanged, pvItem);
 	if (rc != ECA_NORMAL) {
 		{
 			std::lock_guard<std::mutex> lock(pvItem->ioMutex());
 			pvItem->setErrorCode(rc);
-			if (rc != ECA_NORMAL) pvItem->eventId = nullptr;
+			pvItem->clearStaticFetchIssued();
+		}
+		g.removePendingConnection(pvItem);
+		CaLabDbgPrintf("Warning: Could not fetch %s. %s", pvItem->getName().c_str(), ca_message_safe(rc));
+	}
+}
+
+void subscribeOrFetchPv(PVItem* pvItem) {
+	if (pvItem->isStaticField()) {
+		fetchPvOnce(pvItem);
+	}
+	else {
+		subscribePv(pvItem);
+	}
+}
+
+bool needsSubscribeOrFetch_callerLocked(const PVItem* pvItem) {
+	if (!pvItem->isConnected()) return false;
+	return pvItem->isStaticField() ? !pvItem->isStaticFetchIssued() : pvItem->eventId == nullptr;
+}
+
+namespace {
+	// Fields delivered by DBR_CTRL_DOUBLE (numeric records) or DBR_CTRL_ENUM (enum records).
+	bool isCtrlMetadataField(const std::string& fieldName, short dbfType) {
+		static const std::unordered_set<std::string> numericFields = {
+			"PREC", "EGU", "HOPR", "LOPR", "HIHI", "HIGH", "LOW", "LOLO", "DRVH", "DRVL"
+		};
+		static const std::unordered_set<std::string> enumFields = {
+			"ZRST", "ONST", "TWST", "THST", "FRST", "FVST", "SXST", "SVST",
+			"EIST", "NIST", "TEST", "ELST", "TVST", "TTST", "FTST", "FFST"
+		};
+		switch (dbfType) {
+		case DBF_SHORT: case DBF_FLOAT: case DBF_CHAR: case DBF_LONG: case DBF_DOUBLE:
+			return numericFields.count(fieldName) != 0;
+		case DBF_ENUM:
+			return enumFields.count(fieldName) != 0;
+		default:
+			return false;
 		}
-		CaLabDbgPrintf("Warning: Could not create subscription for %s. %s", pvItem->getName().c_str(), ca_message_safe(rc));
 	}
 }
 
@@ -2959,6 +4261,8 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
         bool hasRecordType = false;
         {
             std::lock_guard<std::mutex> lk(ref.parent->ioMutex());
+            // Without a field list there is nothing to validate; don't wait for the record type.
+            if (ref.parent->getFields().empty()) continue;
             hasRecordType = !ref.parent->getRecordType().empty();
         }
         if (!hasRecordType && !waitForRecordType(ref)) {
@@ -2983,11 +4287,14 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
 
             std::string recordType;
             std::vector<std::pair<std::string, chanId>> fields;
+            short parentType = -1;
             {
                 std::lock_guard<std::mutex> lk(parent->ioMutex());
                 recordType = parent->getRecordType();
                 fields = parent->getFields();
+                parentType = parent->getDbrType();
             }
+            bool useCtrlMetadata = false;
 			if (recordType.empty() || fields.empty()) {
 				continue;
 			}
@@ -2998,6 +4305,11 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
 				if (!isApproved) {
 					continue;
 				}
+				if (g.bCaLabCtrlMetadata && isCtrlMetadataField(fieldName, parentType)) {
+					// Served by the base channel's DBE_PROPERTY subscription; no field channel needed.
+					useCtrlMetadata = true;
+					continue;
+				}
                 std::string fieldPvName = ref.baseName + "." + fieldName;
                 PVItem* fieldItem = nullptr;
                 auto fit = g.pvRegistry.find(fieldPvName);
@@ -3015,6 +4327,7 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
                 }
                 if (!fieldItem) continue;
 
+                fieldItem->setStaticField(g.recordFieldIsStatic(fieldName));
                 if (fieldItem->channelId == nullptr) {
                     g.addPendingConnection(fieldItem);
                     int result = ca_create_channel(fieldPvName.c_str(), connectionChanged, fieldItem, CA_PRIORITY_DEFAULT, &fieldItem->channelId);
@@ -3028,6 +4341,10 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
                 }
                 fieldItems.push_back(fieldItem);
             }
+            if (useCtrlMetadata) {
+                parent->setCtrlMetadataWanted();
+                subscribeCtrlMetadata(parent);
+            }
         }
     };
 
@@ -3043,13 +4360,13 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
 			for (auto* item : fieldItems) {
 				if (item && item->isConnected()) {
 					std::lock_guard<std::mutex> lk(item->ioMutex());
-					if (item->eventId == nullptr) {
+					if (needsSubscribeOrFetch_callerLocked(item)) {
 						toSubscribe.push_back(item);
 					}
 				}
 			}
 		}
-		for (auto* item : toSubscribe) { subscribePv(item); }
+		for (auto* item : toSubscribe) { subscribeOrFetchPv(item); }
 		if (!toSubscribe.empty()) ca_poll();
 	}
 
@@ -3068,14 +4385,14 @@ void connectPVs(const std::unordered_set<std::string>& basePvNames, double Timeo
 				bool needsSubscription = false;
 				{
 					std::lock_guard<std::mutex> lk(item->ioMutex());
-					needsSubscription = (item->isConnected() && item->eventId == nullptr);
+					needsSubscription = needsSubscribeOrFetch_callerLocked(item);
 					// If not connected yet, we are not done.
 					if (!item->isConnected()) allDone = false;
 				}
 				if (needsSubscription) toSubscribeDynamic.push_back(item);
 			}
 		}
-		for (auto* item : toSubscribeDynamic) { subscribePv(item); }
+		for (auto* item : toSubscribeDynamic) { subscribeOrFetchPv(item); }
 		if (!toSubscribeDynamic.empty()) ca_poll();
 		if (allDone) break;
 		g.waitForNotification(std::chrono::milliseconds(100));
@@ -3134,13 +4451,21 @@ void waitForUninitializedPvs(const std::unordered_set<std::string>& basePvNames,
 			PVItem* parent = parentAndFields.first;
 			// Determine record type once per parent to validate fields.
 			std::string recordType;
+			short parentType = -1;
 			{
 				std::lock_guard<std::mutex> lk(parent->ioMutex());
 				recordType = parent->getRecordType();
+				parentType = parent->getDbrType();
 			}
 			// If the record type is unknown here, skip waiting for fields of this parent.
 			if (recordType.empty()) continue;
+			// Fields served from DBR_CTRL are complete once the property callback arrived, even
+			// when empty (no EGU, unused enum states); there is no field PV to fall back on.
+			const bool ctrlReceived = g.bCaLabCtrlMetadata && parent->isCtrlMetadataReceived();
 			for (const auto& fieldName : parentAndFields.second) {
+				if (ctrlReceived && isCtrlMetadataField(fieldName, parentType)) {
+					continue;
+				}
 				// Only wait for approved fields or those actually present in the registry.
 				bool isApproved = Globals::getInstance().recordFieldIsCommonField(fieldName) ||
 					Globals::getInstance().recordFieldExists(recordType, fieldName);
@@ -3198,6 +4523,7 @@ void connectPv(PVItem* pvItem, bool connectRtyp) {
 			// Channel exists but is not connected - clear it and recreate			
 			pvItem->channelId = nullptr;
 			pvItem->eventId = nullptr;
+			pvItem->propertyEventId = nullptr;
 			pvItem->setConnected(false);
 			needsNewChannel = true;
 		}
@@ -3212,6 +4538,21 @@ void connectPv(PVItem* pvItem, bool connectRtyp) {
 		}
 	}
 
+	if (connectRtyp) {
+		// Record types resolved earlier in this process are served from the cache.
+		// Types loaded from the metadata cache file or kept across a reconnect are used right
+		// away but still verified via .RTYP.
+		std::string cachedType;
+		bool unverified = false;
+		if (g.cachedRecordType(pvItem->getName(), cachedType, &unverified)) {
+			std::lock_guard<std::mutex> lk(pvItem->ioMutex());
+			if (pvItem->getRecordType().empty()) {
+				pvItem->setRecordType(cachedType);
+			}
+			connectRtyp = unverified;
+		}
+	}
+
 	if (connectRtyp) {
 		std::string rtypPvName = pvItem->getName() + ".RTYP";
 		auto it = g.pvRegistry.find(rtypPvName);
@@ -3221,6 +4562,7 @@ void connectPv(PVItem* pvItem, bool connectRtyp) {
 			auto newPvItem = std::make_unique<PVItem>(rtypPvName);
 			rtypPvItem = newPvItem.get();
 			rtypPvItem->parent = pvItem;
+			rtypPvItem->setStaticField(true);
 			g.pvRegistry[rtypPvName] = std::move(newPvItem);
 		}
 		else {
@@ -3247,6 +4589,7 @@ void connectPv(PVItem* pvItem, bool connectRtyp) {
 				else if (ca_state(rtypPvItem->channelId) != cs_conn) {
 					rtypPvItem->channelId = nullptr;
 					rtypPvItem->eventId = nullptr;
+					rtypPvItem->clearStaticFetchIssued();
 					rtypPvItem->setConnected(false);
 					rtypPvItem->setHasValue(false);
 					rtypNeedsChannel = true;
@@ -3264,7 +4607,7 @@ void connectPv(PVItem* pvItem, bool connectRtyp) {
 	}
 }
 
-void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double Timeout, std::chrono::steady_clock::time_point endBy, LVBoolean* NoMDEL) {
+void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double Timeout, std::chrono::steady_clock::time_point endBy, LVBoolean* NoMDEL, bool resolveRecordType) {
 	if (basePvNames.empty())
 		return;
 	Globals& g = Globals::getInstance();
@@ -3273,7 +4616,7 @@ void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double
 		std::chrono::milliseconds((long long)((Timeout > 0.0 ? Timeout : 0.0) * 1000 * offset));
 	const auto deadline = std::min(ownDeadline, endBy);
 
-	// Connect base and .RTYP channels.
+	// Connect base channels, and .RTYP channels only if the caller needs record types.
 	{
 		TimeoutUniqueLock<std::shared_timed_mutex> lock(g.pvRegistryLock, "subscribeBasePVs-connect");
 		if (!lock.isLocked())
@@ -3282,7 +4625,7 @@ void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double
 			auto it = g.pvRegistry.find(name);
 			if (it != g.pvRegistry.end() && it->second) {
 				g.addPendingConnection(it->second.get());
-				connectPv(it->second.get(), /*connectRtyp=*/true);
+				connectPv(it->second.get(), resolveRecordType);
 			}
 			else {
 				CaLabDbgPrintf("Warning: Base PV not found in registry: %s", name.c_str());
@@ -3305,6 +4648,7 @@ void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double
 			for (const auto& name : basePvNames) {
 				// Subscribe base PV if it just connected and has no event yet.
 				auto bit = g.pvRegistry.find(name);
+				bool hasRecordType = false;
 				if (bit != g.pvRegistry.end() && bit->second) {
 					PVItem* baseItem = bit->second.get();
 					bool needsSubscription = false;
@@ -3314,34 +4658,41 @@ void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double
 						if (!baseItem->isConnected()) {
 							allDone = false;
 						}
+						hasRecordType = !baseItem->getRecordType().empty();
 					}
 					if (needsSubscription) {
 						toSubscribeDynamic.push_back(baseItem);
 					}
 				}
 
-				// Subscribe .RTYP PV if it just connected and has no event yet.
+				if (!resolveRecordType) {
+					continue;
+				}
+				// Subscribe .RTYP PV if it just connected and has no event yet. A type already served
+				// from the cache is only being verified: connectionChanged fetches .RTYP whenever it
+				// connects, so it does not hold up the caller.
 				auto rit = g.pvRegistry.find(name + ".RTYP");
 				if (rit != g.pvRegistry.end() && rit->second) {
 					PVItem* rtypItem = rit->second.get();
 					bool needsSubscriptionRtyp = false;
 					{
 						std::lock_guard<std::mutex> lk(rtypItem->ioMutex());
-						needsSubscriptionRtyp = (rtypItem->isConnected() && rtypItem->eventId == nullptr);
-						if (!rtypItem->isConnected()) allDone = false;
+						needsSubscriptionRtyp = needsSubscribeOrFetch_callerLocked(rtypItem);
+						if (!rtypItem->isConnected() && !hasRecordType) allDone = false;
 					}
 					if (needsSubscriptionRtyp) {
 						toSubscribeDynamic.push_back(rtypItem);
 					}
 				}
-				else {
+				else if (!hasRecordType) {
+					// No .RTYP channel: the record type must already be known from the cache.
 					allDone = false;
 				}
 			}
 		}
 		// Perform subscriptions outside the registry lock.
 		for (auto* item : toSubscribeDynamic) {
-			subscribePv(item);
+			subscribeOrFetchPv(item);
 		}
 		if (!toSubscribeDynamic.empty()) {
 			ca_flush_io();
@@ -3363,6 +4714,136 @@ void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double
 	}*/
 }
 
+// If this is an ENUM PV and its enum labels have not been fetched yet, request them now.
+static void requestEnumLabels(const struct event_handler_args& args) {
+	Globals& g = Globals::getInstance();
+	if (args.usr && args.status == ECA_NORMAL) {
+		PVItem* pvItem = static_cast<PVItem*>(args.usr);
+		// Use the field type from the channel for robustness.
+		short fieldType = ca_field_type(args.chid);
+		if ((pvItem->getDbrType() == DBF_ENUM || fieldType == DBF_ENUM)) {
+			// Only request labels if we don't have them yet (or only from the cache file) and no request is in-flight.
+			const auto& labels = pvItem->getEnumStrings();
+			if ((labels.empty() || pvItem->hasCachedEnumStrings()) && pvItem->tryMarkEnumFetchRequested()) {
+				g.addPendingConnection(pvItem);
+				int rc = ca_array_get_callback(DBR_CTRL_ENUM, 1, args.chid, enumInfoChanged, pvItem);
+				if (rc != ECA_NORMAL) {
+					pvItem->setErrorCode(rc);
+					pvItem->clearEnumFetchRequested();
+					g.removePendingConnection(pvItem);
+					CaLabDbgPrintf("Info: enum metadata request for %s deferred: %s", pvItem->getName().c_str(), ca_message_safe(rc));
+				}
+			}
+		}
+	}
+}
+
+// Completion of a pipelined poll get. The value is copied into the PVItem's poll stage
+// (reused across rounds) instead of a malloc'd copy, and applied by the value worker like a
+// monitor update. The worker clears the in-flight mark, so the next round waits for it.
+static void pollGetCompleted(struct event_handler_args args) {
+	PVItem* pvItem = static_cast<PVItem*>(args.usr);
+	Globals& g = Globals::getInstance();
+	if (!pvItem || g.stopped.load()) return;
+
+	ValueChangeTask task;
+	task.pvName = pvItem->getName();
+	task.type = args.type;
+	task.nElems = args.count;
+	task.pollStaged = true;
+	const size_t elemSize = (args.status == ECA_NORMAL && args.dbr) ? dbrValueElementSize(args.type) : 0;
+	if (elemSize == 0) {
+		task.errorCode = (args.status != ECA_NORMAL) ? args.status : ECA_BADTYPE;
+	}
+	else {
+		// Staged under ioMutex: a disconnect may clear the in-flight mark before the worker ran.
+		const unsigned char* src = static_cast<const unsigned char*>(dbr_value_ptr(args.dbr, args.type));
+		task.dataBytes = elemSize * args.count;
+		{
+			std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+			pvItem->pollStage().assign(src, src + task.dataBytes);
+		}
+		if (args.type >= DBR_TIME_STRING && args.type <= DBR_TIME_DOUBLE) {
+			const struct dbr_time_double* timePtr = reinterpret_cast<const struct dbr_time_double*>(args.dbr);
+			task.hasTimeMeta = true;
+			task.secPastEpoch = timePtr->stamp.secPastEpoch;
+			task.nsec = timePtr->stamp.nsec;
+			task.status = timePtr->status;
+			task.severity = timePtr->severity;
+		}
+	}
+	enqueueTask(std::move(task));
+	requestEnumLabels(args);
+}
+
+// Issues the pipelined get of a connected PV unless one is already in flight; true if issued.
+// The caller flushes.
+static bool issuePollGet(PVItem* pvItem) {
+	if (!pvItem->isConnected() || !pvItem->channelId || ca_state(pvItem->channelId) != cs_conn) return false;
+	if (!pvItem->tryMarkPollGetInFlight()) return false;
+	const int requestedDbrType = dbf_type_to_DBR_TIME(pvItem->getDbrType());
+	int rc = ECA_BADTYPE;
+	if (requestedDbrType >= 0) {
+		rc = ca_array_get_callback(requestedDbrType, pvItem->getNumberOfValues(), pvItem->channelId, pollGetCompleted, pvItem);
+	}
+	if (rc != ECA_NORMAL) {
+		pvItem->clearPollGetInFlight();
+		std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+		pvItem->setErrorCode(rc);
+		return false;
+	}
+	return true;
+}
+
+// Pipelined polling: issue ca_array_get_callback for every connected PV that has no get
+// outstanding and return immediately with the values of the rounds completed so far.
+// pollGetCompleted stages into each PVItem's reusable poll buffer, so no per-call get buffers
+// are allocated here. Only PVs that never had a value are waited for (first call).
+static std::vector<uInt32> getPipelinedPollIndices(sLongArrayHdl* PvIndexArray, uInt32 count, std::chrono::steady_clock::time_point endBy) {
+	std::vector<uInt32> changedIndices;
+	std::vector<uInt32> awaitingFirstValue;
+	Globals& g = Globals::getInstance();
+
+	bool issued = false;
+	for (uInt32 i = 0; i < count; ++i) {
+		PvEntryHandle entry{ PvIndexArray, i };
+		if (!entry) continue;
+		PVItem* pvItem = entry->pvItem;
+		if (!pvItem || !pvItem->isConnected() || !pvItem->channelId) continue;
+		if (ca_state(pvItem->channelId) != cs_conn) continue;
+
+		if (issuePollGet(pvItem)) {
+			issued = true;
+		}
+		if (pvItem->hasValue()) {
+			changedIndices.push_back(i);
+		}
+		else {
+			awaitingFirstValue.push_back(i);
+		}
+	}
+	if (issued) {
+		ca_flush_io();
+	}
+
+	// First round: block until the initial values arrived (or the deadline passed).
+	while (!awaitingFirstValue.empty() && std::chrono::steady_clock::now() < endBy) {
+		g.waitForNotification(std::chrono::milliseconds(50));
+		ca_pend_event(0.001);
+		auto it = std::remove_if(awaitingFirstValue.begin(), awaitingFirstValue.end(), [&](uInt32 idx) {
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (entry && entry->pvItem && entry->pvItem->hasValue()) {
+				changedIndices.push_back(idx);
+				return true;
+			}
+			return false;
+			});
+		awaitingFirstValue.erase(it, awaitingFirstValue.end());
+	}
+	std::sort(changedIndices.begin(), changedIndices.end());
+	return changedIndices;
+}
+
 std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Timeout, std::chrono::steady_clock::time_point endBy, LVBoolean* NoMDEL /*= nullptr*/) {
 	std::vector<uInt32> changedIndices;
 	if (!PvIndexArray || !*PvIndexArray) return changedIndices;
@@ -3370,6 +4851,11 @@ std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Time
 	const bool isNoMDEL = (NoMDEL != nullptr && *NoMDEL);
 	uInt32 count = (uInt32)(**PvIndexArray)->dimSize;
 
+	// Pipelined NoMDEL mode: return the previous round, start the next one without blocking
+	if (isNoMDEL && Globals::getInstance().bCaLabPollingPipelined) {
+		return getPipelinedPollIndices(PvIndexArray, count, endBy);
+	}
+
 	// In NoMDEL mode: ALL connected PVs should be fetched every time
 	if (isNoMDEL) {
 		// Add all connected PVs to changedIndices
@@ -3520,9 +5006,20 @@ std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Time
 		return changedIndices;
 	}
 
-	// Normal mode (with subscriptions): only return PVs that have changes
+	// Normal mode (with subscriptions): only return PVs that have changes.
+	// All entries of the array share one dirty set filled by the PVItems on every
+	// update, so only indices that were touched since the last read are examined.
+	std::shared_ptr<PvDirtySet> dirtySet = findDirtySet(PvIndexArray);
+	if (!dirtySet) return changedIndices;
+
+	std::vector<uInt32> dirtyIndices = dirtySet->drain();
+	std::sort(dirtyIndices.begin(), dirtyIndices.end());
+
 	bool waitForSubscription = false;
-	for (uInt32 i = 0; i < count; ++i) {
+	std::vector<uInt32> subscribedIndices;
+	std::vector<uInt32> enumPendingIndices;
+	for (uInt32 i : dirtyIndices) {
+		if (i >= count) continue;
 		PvEntryHandle entry{ PvIndexArray, i };
 		if (!entry) continue;
 		if (!entry->metaInfo || !entry->metaInfo->pvItem) { continue; }
@@ -3533,10 +5030,19 @@ std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Time
 			waitForSubscription = true;
 			subscribePv(pvItem);
 			changedIndices.push_back(i);
+			subscribedIndices.push_back(i);
+			continue;
 		}
-		else if (entry->metaInfo->hasChanged()) {
+		if (entry->metaInfo->hasChanged()) {
 			changedIndices.push_back(i);
 		}
+		// ENUM PVs that still need their labels are refreshed once the labels arrive.
+		if (pvItem->isConnected() && pvItem->hasValue()) {
+			short dbrType = pvItem->getDbrType();
+			if ((dbrType == DBR_ENUM || dbrType == DBR_TIME_ENUM) && pvItem->getEnumStrings().empty()) {
+				enumPendingIndices.push_back(i);
+			}
+		}
 	}
 
 	// Normal mode: Wait until all PVs in changedIndices have a value via subscription
@@ -3577,23 +5083,19 @@ std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Time
 			Globals::getInstance().waitForNotification(std::chrono::milliseconds(100));
 			ca_pend_event(0.001);
 		}
-	}
-
-	// After values have arrived, check for ENUM PVs that still need their labels.
-	std::vector<uInt32> enumPendingIndices;
-	for (uInt32 i = 0; i < count; ++i) {
-		PvEntryHandle entry{ PvIndexArray, i };
-		if (!entry) continue;
-		if (!entry->metaInfo || !entry->metaInfo->pvItem) {continue; }
-		PVItem* pvItem = entry->metaInfo->pvItem;
 
-		if (pvItem->isConnected() && pvItem->hasValue()) {
+		// Check freshly subscribed ENUM PVs for labels; keep the ones still without a value dirty.
+		for (uInt32 idx : subscribedIndices) {
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (!entry || !entry->metaInfo || !entry->metaInfo->pvItem) continue;
+			PVItem* pvItem = entry->metaInfo->pvItem;
+			if (!pvItem->hasValue()) {
+				if (pvItem->isConnected()) dirtySet->mark(idx);
+				continue;
+			}
 			short dbrType = pvItem->getDbrType();
-			if (dbrType == DBR_ENUM || dbrType == DBR_TIME_ENUM) {
-				const auto& labels = pvItem->getEnumStrings();
-				if (labels.empty()) {
-					enumPendingIndices.push_back(i);
-				}
+			if ((dbrType == DBR_ENUM || dbrType == DBR_TIME_ENUM) && pvItem->getEnumStrings().empty()) {
+				enumPendingIndices.push_back(idx);
 			}
 		}
 	}
@@ -3627,6 +5129,12 @@ std::vector<uInt32> getChangedPvIndices(sLongArrayHdl* PvIndexArray, double Time
 			if (std::find(changedIndices.begin(), changedIndices.end(), idx) == changedIndices.end()) {
 				changedIndices.push_back(idx);
 			}
+			// Labels still missing: look at this entry again on the next read.
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (entry && entry->metaInfo && entry->metaInfo->pvItem &&
+				entry->metaInfo->pvItem->getEnumStrings().empty()) {
+				dirtySet->mark(idx);
+			}
 		}
 	}
 
@@ -3660,238 +5168,346 @@ void updatePvIndexArray(sLongArrayHdl* PvIndexArray, const std::vector<uInt32>&
 	}
 }
 
-void populateOutputArrays(uInt32 nameCount, uInt32 maxNumberOfValues, int filter, sLongArrayHdl* PvIndexArray, sResultArrayHdl* ResultArray, sStringArrayHdl* FirstStringValue, sDoubleArrayHdl* FirstDoubleValue, sDoubleArray2DHdl* DoubleValueArray, const std::vector<uInt32>& changedIndices) {
-	// Determine the indices to update.
-	const std::vector<uInt32> indicesToUpdate = changedIndices.empty() ?
-		makeIndexRange(nameCount) : changedIndices;
-
-	// Update only the changed elements.
-	for (uInt32 idx : indicesToUpdate) {
-		if (idx >= nameCount) continue;
-
-		PvEntryHandle entry{ PvIndexArray, idx };
-		if (!entry || !entry->pvItem || !entry->metaInfo) {
-			continue;
+namespace {
+	// Number of indices from which populateOutputArrays stages on the worker pool.
+	constexpr size_t kParallelStagingThreshold = 10000;
+
+	// Small fixed-size thread pool used to stage getValue outputs of very large PV lists.
+	// Work is handed out in chunks through an atomic cursor; the calling thread takes part too.
+	class StagingPool {
+	public:
+		~StagingPool() { stop(); }
+
+		// Run fn(i) for every i in [0, n) and return when all calls have finished.
+		void parallelFor(size_t n, const std::function<void(size_t)>& fn) {
+			if (n == 0) return;
+			std::lock_guard<std::mutex> runLock(runMtx_);
+			if (!ensureStarted()) {
+				for (size_t i = 0; i < n; ++i) fn(i);
+				return;
+			}
+			{
+				std::lock_guard<std::mutex> lk(mtx_);
+				job_ = &fn;
+				jobSize_ = n;
+				cursor_.store(0, std::memory_order_relaxed);
+				busyWorkers_ = threads_.size();
+				++jobSeq_;
+			}
+			cv_.notify_all();
+			runChunks();
+			std::unique_lock<std::mutex> lk(mtx_);
+			doneCv_.wait(lk, [this] { return busyWorkers_ == 0; });
+			job_ = nullptr;
+		}
+
+		// Join all pool threads (registered as background worker stop hook).
+		void stop() {
+			{
+				std::lock_guard<std::mutex> lk(mtx_);
+				if (threads_.empty()) return;
+				stopping_ = true;
+			}
+			cv_.notify_all();
+			for (auto& t : threads_) {
+				if (t.joinable()) t.join();
+			}
+			std::lock_guard<std::mutex> lk(mtx_);
+			threads_.clear();
+			stopping_ = false;
 		}
-		PVItem* pvItem = entry->pvItem;
-		// Prepare a copy of field names while holding the PV lock, then allocate/fill outside.
-		std::vector<std::string> fieldNamesCopy;
-		std::vector<std::string> cachedStringValues;
-		std::vector<double> cachedNumericValues;
-		short dbrType = DBR_CHAR;
-		bool isNumericType = false;
 
-		// Hold the entry acquired for the duration we use metaInfo/pvItem.
-		{
-			std::lock_guard<std::mutex> lock(pvItem->ioMutex());
-			const bool needsStringValues = (filter & (out_filter::firstValueAsString | out_filter::pviValuesAsString)) != 0;
-			const bool needsNumericValues = (filter & (out_filter::firstValueAsNumber | out_filter::pviValuesAsNumber | out_filter::valueArrayAsNumber)) != 0;
-
-			dbrType = pvItem->getDbrType();
-			isNumericType = (dbrType >= DBR_CHAR && dbrType <= DBR_DOUBLE) || (dbrType >= DBR_TIME_CHAR && dbrType <= DBR_TIME_DOUBLE);
+	private:
+		static constexpr size_t kChunk = 256;
 
-			if (needsNumericValues || (needsStringValues && isNumericType)) {
-				cachedNumericValues = pvItem->dbrValue2Double();
+		bool ensureStarted() {
+			std::lock_guard<std::mutex> lk(mtx_);
+			if (!threads_.empty()) return true;
+			const unsigned hw = std::thread::hardware_concurrency();
+			const size_t count = hw > 1 ? std::min<size_t>(hw - 1, 8) : 0;
+			if (count == 0) return false;
+			for (size_t i = 0; i < count; ++i) {
+				threads_.emplace_back([this] { workerLoop(); });
 			}
+			Globals::getInstance().registerBackgroundWorker("outputStagingPool", [this] { stop(); });
+			return true;
+		}
 
-			if (needsStringValues && !isNumericType) {
-				cachedStringValues = pvItem->dbrValue2String(); // Native Strings
+		void runChunks() {
+			for (;;) {
+				const size_t begin = cursor_.fetch_add(kChunk, std::memory_order_relaxed);
+				if (begin >= jobSize_) break;
+				const size_t end = std::min(begin + kChunk, jobSize_);
+				for (size_t i = begin; i < end; ++i) {
+					try {
+						(*job_)(i);
+					}
+					catch (...) {
+						CaLabDbgPrintf("StagingPool: exception while staging index %zu", i);
+					}
+				}
 			}
 		}
 
-		if (!cachedNumericValues.empty() && isNumericType && (filter & (out_filter::firstValueAsString | out_filter::pviValuesAsString))) {
-			cachedStringValues.reserve(cachedNumericValues.size());
-			for (double val : cachedNumericValues) {
-				cachedStringValues.emplace_back(pvItem->FormatUnit(val, std::string()));
-			}
+		void workerLoop() {
+			uint64_t seenSeq = 0;
+			for (;;) {
+				{
+					std::unique_lock<std::mutex> lk(mtx_);
+					cv_.wait(lk, [&] { return stopping_ || jobSeq_ != seenSeq; });
+					// Finish a job that is already handed out before honoring a stop request.
+					if (jobSeq_ == seenSeq) return;
+					seenSeq = jobSeq_;
+				}
+				runChunks();
+				{
+					std::lock_guard<std::mutex> lk(mtx_);
+					--busyWorkers_;
+				}
+				doneCv_.notify_one();
+			}
+		}
+
+		std::mutex runMtx_;
+		std::mutex mtx_;
+		std::condition_variable cv_;
+		std::condition_variable doneCv_;
+		std::vector<std::thread> threads_;
+		const std::function<void(size_t)>* job_ = nullptr;
+		size_t jobSize_ = 0;
+		std::atomic<size_t> cursor_{ 0 };
+		size_t busyWorkers_ = 0;
+		uint64_t jobSeq_ = 0;
+		bool stopping_ = false;
+	} g_stagingPool;
+
+	// Snapshot of everything getValue writes for one PV, built without touching LV handles.
+	struct StagedPvOutput {
+		bool valid = false;
+		std::vector<std::string> stringValues;
+		std::vector<double> numericValues;
+		int16_t status = 0;
+		int16_t severity = 0;
+		uInt32 timestamp = 0;
+		std::string statusString;
+		std::string severityString;
+		std::string timestampString;
+		int errorCode = ECA_NORMAL;
+		std::string errorString;
+		uInt32 numberOfValues = 0;
+		bool isBasePv = false;
+		std::vector<std::string> fieldNames;
+		std::vector<std::string> fieldValues;
+
+		// Reset for the next PV while keeping the capacity of every buffer.
+		void clear() {
+			valid = false;
+			stringValues.clear();
+			numericValues.clear();
+			status = 0;
+			severity = 0;
+			timestamp = 0;
+			statusString.clear();
+			severityString.clear();
+			timestampString.clear();
+			errorCode = ECA_NORMAL;
+			errorString.clear();
+			numberOfValues = 0;
+			isBasePv = false;
+			fieldNames.clear();
+			fieldValues.clear();
 		}
+	};
 
+	// Convert and format one PV into a staging buffer. Safe to call from any thread.
+	void stagePvOutput(PVItem* pvItem, int filter, StagedPvOutput& out) {
+		const bool needsStringValues = (filter & (out_filter::firstValueAsString | out_filter::pviValuesAsString)) != 0;
+		const bool needsNumericValues = (filter & (out_filter::firstValueAsNumber | out_filter::pviValuesAsNumber | out_filter::valueArrayAsNumber)) != 0;
+		bool isNumericType = false;
 		{
 			std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+			const short dbrType = pvItem->getDbrType();
+			isNumericType = (dbrType >= DBR_CHAR && dbrType <= DBR_DOUBLE) || (dbrType >= DBR_TIME_CHAR && dbrType <= DBR_TIME_DOUBLE);
 
-			// Ensure ErrorIO reflects the current error state for all PVs, not just changed ones.
-			if ((filter & out_filter::pviError) && ResultArray && *ResultArray && PvIndexArray && *PvIndexArray && **PvIndexArray) {
-				// Fast skip if no PV currently has an error.
-				if (Globals::getInstance().pvErrorCount.load(std::memory_order_relaxed) > 0) {
-					for (uInt32 i = 0; i < nameCount; ++i) {
-						sResult* currentResult = &(**ResultArray)->result[i];
-						PvEntryHandle currentEntry{ PvIndexArray, i };
-						if (!currentEntry || !currentEntry->pvItem) {
-							continue;
-						}
-						const int err = currentEntry->pvItem->getErrorCode();
-						const uInt32 lvCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
-						if (currentResult->ErrorIO.code == lvCode && currentResult->ErrorIO.source && *currentResult->ErrorIO.source && (*currentResult->ErrorIO.source)->cnt) {
-							// No change; skip updating the string to avoid unnecessary memory operations.
-						}
-						else {
-							currentResult->ErrorIO.code = lvCode;
-							currentResult->ErrorIO.status = 0;
-							// Always provide a message; on success this will be "Normal successful completion".
-							setLVString(currentResult->ErrorIO.source, currentEntry->pvItem->getErrorAsString());
+			if (needsNumericValues || (needsStringValues && isNumericType)) {
+				out.numericValues.resize(pvItem->getNumberOfValues());
+				out.numericValues.resize(pvItem->dbrValue2Double(out.numericValues.data(), static_cast<uInt32>(out.numericValues.size())));
+			}
+			if (needsStringValues && !isNumericType) {
+				pvItem->dbrValue2String(out.stringValues); // Native Strings
+			}
+
+			if (filter & out_filter::pviAll) {
+				out.status = pvItem->getStatus();
+				out.severity = pvItem->getSeverity();
+				out.timestamp = pvItem->getTimestamp();
+				if (filter & out_filter::pviStatusAsString) out.statusString = pvItem->getStatusAsString();
+				if (filter & out_filter::pviSeverityAsString) out.severityString = pvItem->getSeverityAsString();
+				if (filter & out_filter::pviTimestampAsString) out.timestampString = pvItem->getTimestampAsString();
+				if (filter & out_filter::pviError) {
+					out.errorCode = pvItem->getErrorCode();
+					out.errorString = pvItem->getErrorAsString();
+				}
+				out.numberOfValues = pvItem->getNumberOfValues();
+				out.isBasePv = (pvItem->parent == nullptr);
+				if ((filter & (out_filter::pviFieldNames | out_filter::pviFieldValues)) && out.isBasePv) {
+					const auto& fields = pvItem->getFields();
+					out.fieldNames.reserve(fields.size());
+					out.fieldValues.reserve(fields.size());
+					for (const auto& field : fields) {
+						std::string valueStr;
+						if (!pvItem->tryGetFieldString_callerLocked(field.first, valueStr)) {
+							valueStr.clear();
 						}
+						out.fieldNames.push_back(field.first);
+						out.fieldValues.push_back(std::move(valueStr));
 					}
 				}
 			}
+		}
 
-			// Store the first value as a string.
-			if ((filter & out_filter::firstValueAsString) && FirstStringValue && *FirstStringValue && !cachedStringValues.empty()) {
-				setLVString((**FirstStringValue)->elt[idx], cachedStringValues[0]);
-			}
-			// Store the first value as a number.
-			if ((filter & out_filter::firstValueAsNumber) && FirstDoubleValue && *FirstDoubleValue && !cachedNumericValues.empty()) {
-				(**FirstDoubleValue)->elt[idx] = cachedNumericValues[0];
+		if (!out.numericValues.empty() && isNumericType && needsStringValues) {
+			out.stringValues.reserve(out.numericValues.size());
+			for (double val : out.numericValues) {
+				out.stringValues.emplace_back(pvItem->FormatUnit(val, std::string()));
 			}
+		}
+		out.valid = true;
+	}
 
-			// Store the value array as numbers (LabVIEW 2D arrays are row-major: offset = row * cols + col).
-			if ((filter & out_filter::valueArrayAsNumber) && DoubleValueArray && *DoubleValueArray) {
-				const uInt32 rows = (**DoubleValueArray)->dimSizes[0]; // expected: = nameCount
-				const uInt32 cols = (**DoubleValueArray)->dimSizes[1]; // expected: = maxNumberOfValues
-				double* destination = (**DoubleValueArray)->elt;
+	// Write a staged PV into the LabVIEW output handles. Must run on the calling LabVIEW thread.
+	void commitPvOutput(const StagedPvOutput& staged, uInt32 idx, uInt32 nameCount, uInt32 maxNumberOfValues, int filter,
+		sResultArrayHdl* ResultArray, sStringArrayHdl* FirstStringValue, sDoubleArrayHdl* FirstDoubleValue, sDoubleArray2DHdl* DoubleValueArray) {
+		const std::vector<std::string>& cachedStringValues = staged.stringValues;
+		const std::vector<double>& cachedNumericValues = staged.numericValues;
 
-				if (!cachedNumericValues.empty() && rows == nameCount && cols == maxNumberOfValues) {
-					const uInt32 valuesSize = static_cast<uInt32>(cachedNumericValues.size());
-					const uInt32 copyCount = std::min(valuesSize, cols);
+		// Store the first value as a string.
+		if ((filter & out_filter::firstValueAsString) && FirstStringValue && *FirstStringValue && !cachedStringValues.empty()) {
+			setLVString((**FirstStringValue)->elt[idx], cachedStringValues[0]);
+		}
+		// Store the first value as a number.
+		if ((filter & out_filter::firstValueAsNumber) && FirstDoubleValue && *FirstDoubleValue && !cachedNumericValues.empty()) {
+			(**FirstDoubleValue)->elt[idx] = cachedNumericValues[0];
+		}
 
-					const uInt32 base = idx * cols; // row-major: write contiguous segment per row
-					for (uInt32 j = 0; j < copyCount; ++j) {
-						destination[base + j] = cachedNumericValues[j];
-					}
-					// Clear remaining columns in this row to avoid stale data
-					for (uInt32 j = copyCount; j < cols; ++j) {
-						destination[base + j] = 0.0;
-					}
-				}
-			}
-			// Populate the ResultArray.
-			if (filter & out_filter::pviAll && ResultArray && *ResultArray) {
-				sResult* currentResult = &(**ResultArray)->result[idx];
-				// Status and Severity as numbers.
-				if (filter & out_filter::pviStatusAsNumber) currentResult->StatusNumber = pvItem->getStatus();
-				if (filter & out_filter::pviSeverityAsNumber) currentResult->SeverityNumber = pvItem->getSeverity();
-				if (filter & out_filter::pviTimestampAsNumber) currentResult->TimeStampNumber = pvItem->getTimestamp();
+		// Store the value array as numbers (LabVIEW 2D arrays are row-major: offset = row * cols + col).
+		if ((filter & out_filter::valueArrayAsNumber) && DoubleValueArray && *DoubleValueArray) {
+			const uInt32 rows = (**DoubleValueArray)->dimSizes[0]; // expected: = nameCount
+			const uInt32 cols = (**DoubleValueArray)->dimSizes[1]; // expected: = maxNumberOfValues
+			double* destination = (**DoubleValueArray)->elt;
 
-				// Status and Severity as strings.
-				if (filter & out_filter::pviStatusAsString) setLVString(currentResult->StatusString, pvItem->getStatusAsString());
-				if (filter & out_filter::pviSeverityAsString) setLVString(currentResult->SeverityString, pvItem->getSeverityAsString());
-				if (filter & out_filter::pviTimestampAsString) setLVString(currentResult->TimeStampString, pvItem->getTimestampAsString());
+			if (!cachedNumericValues.empty() && rows == nameCount && cols == maxNumberOfValues) {
+				const uInt32 valuesSize = static_cast<uInt32>(cachedNumericValues.size());
+				const uInt32 copyCount = std::min(valuesSize, cols);
 
-				// Error cluster (status/code/source).
-				if (filter & out_filter::pviError) {
-					const int err = pvItem->getErrorCode();
-					const uInt32 lvCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
-					if (currentResult->ErrorIO.code == lvCode && currentResult->ErrorIO.source && *currentResult->ErrorIO.source && (*currentResult->ErrorIO.source)->cnt) {
-						// No change; skip updating the string to avoid unnecessary memory operations.
-					}
-					else {
-						currentResult->ErrorIO.code = lvCode;
-						currentResult->ErrorIO.status = 0;
-						setLVString(currentResult->ErrorIO.source, pvItem->getErrorAsString());
-					}
+				const uInt32 base = idx * cols; // row-major: write contiguous segment per row
+				for (uInt32 j = 0; j < copyCount; ++j) {
+					destination[base + j] = cachedNumericValues[j];
 				}
-
-				// Values as strings and numbers.
-				if (filter & out_filter::pviValuesAsString && currentResult->StringValueArray && !cachedStringValues.empty()) {
-					const std::vector<std::string>& values = cachedStringValues;
-					const uInt32 valuesSize = static_cast<uInt32>(values.size());
-					const uInt32 copyCount = std::min(valuesSize, maxNumberOfValues);
-					sStringArray* lvArray = (*currentResult->StringValueArray);
-					for (uInt32 j = 0; j < copyCount; ++j) {
-						LStrHandle& stringHandle = lvArray->elt[j];
-						const std::string& valueString = values[j];
-						// Determine effective length up to the first NUL character.
-						size_t effectiveLen = valueString.find('\0');
-						if (effectiveLen == std::string::npos) effectiveLen = valueString.size();
-						// Skip work if unchanged.
-						if (stringHandle && LStrLen(*stringHandle) == (int32)effectiveLen && (effectiveLen == 0 || memcmp(LStrBuf(*stringHandle), valueString.data(), effectiveLen) == 0)) {
-							continue;
-						}
-						setLVString(stringHandle, valueString);
-					}
+				// Clear remaining columns in this row to avoid stale data
+				for (uInt32 j = copyCount; j < cols; ++j) {
+					destination[base + j] = 0.0;
 				}
-				if ((filter & out_filter::pviValuesAsNumber) && currentResult->ValueNumberArray && !cachedNumericValues.empty()) {
-					const std::vector<double>& values = cachedNumericValues;
-					const uInt32 valuesSize = static_cast<uInt32>(values.size());
-					const uInt32 copyCount = std::min(valuesSize, maxNumberOfValues);
-					double* destination = (*currentResult->ValueNumberArray)->elt;
-					if (copyCount > 0) {
-						memcpy(destination, values.data(), static_cast<size_t>(copyCount) * sizeof(double));
-					}
-					// Clear remaining elements to avoid stale data.
-					for (uInt32 j = copyCount; j < maxNumberOfValues; ++j) {
-						destination[j] = 0.0;
-					}
-					if (filter & out_filter::pviElements) currentResult->valueArraySize = copyCount;
+			}
+		}
+		// Populate the ResultArray.
+		if (filter & out_filter::pviAll && ResultArray && *ResultArray) {
+			sResult* currentResult = &(**ResultArray)->result[idx];
+			// Status and Severity as numbers.
+			if (filter & out_filter::pviStatusAsNumber) currentResult->StatusNumber = staged.status;
+			if (filter & out_filter::pviSeverityAsNumber) currentResult->SeverityNumber = staged.severity;
+			if (filter & out_filter::pviTimestampAsNumber) currentResult->TimeStampNumber = staged.timestamp;
+
+			// Status and Severity as strings.
+			if (filter & out_filter::pviStatusAsString) setLVString(currentResult->StatusString, staged.statusString);
+			if (filter & out_filter::pviSeverityAsString) setLVString(currentResult->SeverityString, staged.severityString);
+			if (filter & out_filter::pviTimestampAsString) setLVString(currentResult->TimeStampString, staged.timestampString);
+
+			// Error cluster (status/code/source).
+			if (filter & out_filter::pviError) {
+				const int err = staged.errorCode;
+				const uInt32 lvCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
+				if (currentResult->ErrorIO.code == lvCode && currentResult->ErrorIO.source && *currentResult->ErrorIO.source && (*currentResult->ErrorIO.source)->cnt) {
+					// No change; skip updating the string to avoid unnecessary memory operations.
 				}
 				else {
-					if (filter & out_filter::pviElements) currentResult->valueArraySize = pvItem->getNumberOfValues();
-				}
-				if ((filter & (out_filter::pviFieldNames | out_filter::pviFieldValues)) && pvItem->parent == nullptr) {
-					const auto& fields = pvItem->getFields();
-					const uInt32 fieldCount = (uInt32)fields.size();
-
-					if ((filter & out_filter::pviFieldNames) && fieldCount > 0) {
-						if (!currentResult->FieldNameArray || !*currentResult->FieldNameArray ||
-							(*currentResult->FieldNameArray)->dimSize != fieldCount) {
-							if (currentResult->FieldNameArray)
-								DeleteStringArray(currentResult->FieldNameArray);
-							const size_t totalSize =
-								sizeof(sStringArray) +                                    // header + 1 element
-								(static_cast<size_t>(fieldCount) - 1) * sizeof(LStrHandle); // remaining elements
-							currentResult->FieldNameArray =	reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-							if (currentResult->FieldNameArray)
-								(*currentResult->FieldNameArray)->dimSize = fieldCount;
-						}
-					}
-					if ((filter & out_filter::pviFieldValues) && fieldCount > 0) {
-						if (!currentResult->FieldValueArray || !*currentResult->FieldValueArray ||
-							(*currentResult->FieldValueArray)->dimSize != fieldCount) {
-							if (currentResult->FieldValueArray)
-								DeleteStringArray(currentResult->FieldValueArray);
-							const size_t totalSize =
-								sizeof(sStringArray) +                                    // header + 1 element
-								(static_cast<size_t>(fieldCount) - 1) * sizeof(LStrHandle); // remaining elements
-							currentResult->FieldValueArray = reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-							if (currentResult->FieldValueArray)
-								(*currentResult->FieldValueArray)->dimSize = fieldCount;
-						}
+					currentResult->ErrorIO.code = lvCode;
+					currentResult->ErrorIO.status = 0;
+					setLVString(currentResult->ErrorIO.source, staged.errorString);
+				}
+			}
+
+			// Values as strings and numbers.
+			if (filter & out_filter::pviValuesAsString && currentResult->StringValueArray && !cachedStringValues.empty()) {
+				const std::vector<std::string>& values = cachedStringValues;
+				const uInt32 valuesSize = static_cast<uInt32>(values.size());
+				const uInt32 copyCount = std::min(valuesSize, maxNumberOfValues);
+				sStringArray* lvArray = (*currentResult->StringValueArray);
+				for (uInt32 j = 0; j < copyCount; ++j) {
+					LStrHandle& stringHandle = lvArray->elt[j];
+					const std::string& valueString = values[j];
+					// Determine effective length up to the first NUL character.
+					size_t effectiveLen = valueString.find('\0');
+					if (effectiveLen == std::string::npos) effectiveLen = valueString.size();
+					// Skip work if unchanged.
+					if (stringHandle && LStrLen(*stringHandle) == (int32)effectiveLen && (effectiveLen == 0 || memcmp(LStrBuf(*stringHandle), valueString.data(), effectiveLen) == 0)) {
+						continue;
 					}
+					setLVString(stringHandle, valueString);
+				}
+			}
+			if ((filter & out_filter::pviValuesAsNumber) && currentResult->ValueNumberArray && !cachedNumericValues.empty()) {
+				const std::vector<double>& values = cachedNumericValues;
+				const uInt32 valuesSize = static_cast<uInt32>(values.size());
+				const uInt32 copyCount = std::min(valuesSize, maxNumberOfValues);
+				double* destination = (*currentResult->ValueNumberArray)->elt;
+				if (copyCount > 0) {
+					memcpy(destination, values.data(), static_cast<size_t>(copyCount) * sizeof(double));
+				}
+				// Clear remaining elements to avoid stale data.
+				for (uInt32 j = copyCount; j < maxNumberOfValues; ++j) {
+					destination[j] = 0.0;
+				}
+				if (filter & out_filter::pviElements) currentResult->valueArraySize = copyCount;
+			}
+			else {
+				if (filter & out_filter::pviElements) currentResult->valueArraySize = staged.numberOfValues;
+			}
+			if ((filter & (out_filter::pviFieldNames | out_filter::pviFieldValues)) && staged.isBasePv) {
+				const uInt32 fieldCount = (uInt32)staged.fieldNames.size();
 
-					for (uInt32 f = 0; f < fieldCount; ++f) {
-						const std::string& fieldName = fields[f].first;
-						if ((filter & out_filter::pviFieldNames) && currentResult->FieldNameArray && *currentResult->FieldNameArray) {
-							setLVString((*currentResult->FieldNameArray)->elt[f], fieldName);
-						}
-						if ((filter & out_filter::pviFieldValues) && currentResult->FieldValueArray && *currentResult->FieldValueArray) {
-							std::string valueStr;
-							if (!pvItem->tryGetFieldString_callerLocked(fieldName, valueStr)) {
-								valueStr.clear();
-							}
-							setLVString((*currentResult->FieldValueArray)->elt[f], valueStr);
-						}
+				if ((filter & out_filter::pviFieldNames) && fieldCount > 0) {
+					if (!currentResult->FieldNameArray || !*currentResult->FieldNameArray ||
+						(*currentResult->FieldNameArray)->dimSize != fieldCount) {
+						resizeStringArray(currentResult->FieldNameArray, fieldCount);
 					}
+				}
+				if ((filter & out_filter::pviFieldValues) && fieldCount > 0) {
+					if (!currentResult->FieldValueArray || !*currentResult->FieldValueArray ||
+						(*currentResult->FieldValueArray)->dimSize != fieldCount) {
+						resizeStringArray(currentResult->FieldValueArray, fieldCount);
+					}
+				}
 
-					if (!(filter & out_filter::pviFieldNames) && currentResult->FieldNameArray) {
-						DeleteStringArray(currentResult->FieldNameArray);
-						currentResult->FieldNameArray = nullptr;
+				for (uInt32 f = 0; f < fieldCount; ++f) {
+					if ((filter & out_filter::pviFieldNames) && currentResult->FieldNameArray && *currentResult->FieldNameArray) {
+						setLVString((*currentResult->FieldNameArray)->elt[f], staged.fieldNames[f]);
 					}
-					if (!(filter & out_filter::pviFieldValues) && currentResult->FieldValueArray) {
-						DeleteStringArray(currentResult->FieldValueArray);
-						currentResult->FieldValueArray = nullptr;
+					if ((filter & out_filter::pviFieldValues) && currentResult->FieldValueArray && *currentResult->FieldValueArray) {
+						setLVString((*currentResult->FieldValueArray)->elt[f], staged.fieldValues[f]);
 					}
+				}
 
-					if (fields.empty()) {
-						if (currentResult->FieldNameArray) {
-							DeleteStringArray(currentResult->FieldNameArray);
-							currentResult->FieldNameArray = nullptr;
-						}
-						if (currentResult->FieldValueArray) {
-							DeleteStringArray(currentResult->FieldValueArray);
-							currentResult->FieldValueArray = nullptr;
-						}
-					}
+				if (!(filter & out_filter::pviFieldNames) && currentResult->FieldNameArray) {
+					DeleteStringArray(currentResult->FieldNameArray);
+					currentResult->FieldNameArray = nullptr;
 				}
-				else {
+				if (!(filter & out_filter::pviFieldValues) && currentResult->FieldValueArray) {
+					DeleteStringArray(currentResult->FieldValueArray);
+					currentResult->FieldValueArray = nullptr;
+				}
+
+				if (fieldCount == 0) {
 					if (currentResult->FieldNameArray) {
 						DeleteStringArray(currentResult->FieldNameArray);
 						currentResult->FieldNameArray = nullptr;
@@ -3902,8 +5518,96 @@ void populateOutputArrays(uInt32 nameCount, uInt32 maxNumberOfValues, int filter
 					}
 				}
 			}
+			else {
+				if (currentResult->FieldNameArray) {
+					DeleteStringArray(currentResult->FieldNameArray);
+					currentResult->FieldNameArray = nullptr;
+				}
+				if (currentResult->FieldValueArray) {
+					DeleteStringArray(currentResult->FieldValueArray);
+					currentResult->FieldValueArray = nullptr;
+				}
+			}
+		}
+	}
+}
+
+void populateOutputArrays(uInt32 nameCount, uInt32 maxNumberOfValues, int filter, sLongArrayHdl* PvIndexArray, sResultArrayHdl* ResultArray, sStringArrayHdl* FirstStringValue, sDoubleArrayHdl* FirstDoubleValue, sDoubleArray2DHdl* DoubleValueArray, const std::vector<uInt32>& changedIndices) {
+	// Determine the indices to update.
+	const std::vector<uInt32> indicesToUpdate = changedIndices.empty() ?
+		makeIndexRange(nameCount) : changedIndices;
+
+	// Ensure ErrorIO reflects the current error state for all PVs, not just changed ones.
+	// Only entries whose error code changed since the last read are refreshed.
+	if ((filter & out_filter::pviError) && ResultArray && *ResultArray && **ResultArray) {
+		std::shared_ptr<PvDirtySet> dirtySet = findDirtySet(PvIndexArray);
+		if (dirtySet) {
+			const uInt32 resultCount = static_cast<uInt32>((**ResultArray)->dimSize);
+			for (uInt32 i : dirtySet->drainErrors()) {
+				if (i >= nameCount) continue;
+				if (i >= resultCount) {
+					// Not written this time; keep the mark for the next read.
+					dirtySet->markError(i);
+					continue;
+				}
+				PvEntryHandle currentEntry{ PvIndexArray, i };
+				if (!currentEntry || !currentEntry->pvItem) {
+					continue;
+				}
+				sResult* currentResult = &(**ResultArray)->result[i];
+				const int err = currentEntry->pvItem->getErrorCode();
+				const uInt32 lvCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
+				if (currentResult->ErrorIO.code == lvCode && currentResult->ErrorIO.source && *currentResult->ErrorIO.source && (*currentResult->ErrorIO.source)->cnt) {
+					// No change; skip updating the string to avoid unnecessary memory operations.
+				}
+				else {
+					currentResult->ErrorIO.code = lvCode;
+					currentResult->ErrorIO.status = 0;
+					// Always provide a message; on success this will be "Normal successful completion".
+					setLVString(currentResult->ErrorIO.source, currentEntry->pvItem->getErrorAsString());
+				}
+			}
+		}
+	}
+
+	// Large reads: convert and format on the staging pool, then commit serially into LV handles.
+	if (indicesToUpdate.size() >= kParallelStagingThreshold) {
+		// Per calling thread and grown only, so repeated reads reuse the slots and their buffers.
+		// Bound to a reference here: inside the lambda the name would denote the pool thread's copy.
+		thread_local std::vector<StagedPvOutput> t_staged;
+		std::vector<StagedPvOutput>& staged = t_staged;
+		if (staged.size() < indicesToUpdate.size()) staged.resize(indicesToUpdate.size());
+		g_stagingPool.parallelFor(indicesToUpdate.size(), [&](size_t k) {
+			staged[k].clear();
+			const uInt32 idx = indicesToUpdate[k];
+			if (idx >= nameCount) return;
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (!entry || !entry->pvItem || !entry->metaInfo) return;
+			stagePvOutput(entry->pvItem, filter, staged[k]);
+		});
+		for (size_t k = 0; k < indicesToUpdate.size(); ++k) {
+			if (!staged[k].valid) continue;
+			commitPvOutput(staged[k], indicesToUpdate[k], nameCount, maxNumberOfValues, filter,
+				ResultArray, FirstStringValue, FirstDoubleValue, DoubleValueArray);
+		}
+		return;
+	}
+
+	// Update only the changed elements.
+	StagedPvOutput staged;
+	for (uInt32 idx : indicesToUpdate) {
+		if (idx >= nameCount) continue;
+
+		{
+			PvEntryHandle entry{ PvIndexArray, idx };
+			if (!entry || !entry->pvItem || !entry->metaInfo) {
+				continue;
+			}
+			staged.clear();
+			stagePvOutput(entry->pvItem, filter, staged);
 		}
-		// Done with this entry
+		commitPvOutput(staged, idx, nameCount, maxNumberOfValues, filter,
+			ResultArray, FirstStringValue, FirstDoubleValue, DoubleValueArray);
 	}
 }
 
@@ -3948,6 +5652,8 @@ void connectionChanged(connection_handler_args args) {
 			pvItem->setSeverity(epicsSevInvalid);
 			pvItem->setStatus(epicsAlarmComm);
 			pvItem->setErrorCode(ECA_DISCONNCHID);
+			pvItem->clearPollGetInFlight();
+			pvItem->clearStaticFetchIssued();
 			evToClear = pvItem->eventId;
 			pvItem->eventId = nullptr;
 			pvItem->updateChangeHash();
@@ -3956,6 +5662,24 @@ void connectionChanged(connection_handler_args args) {
 	if (evToClear) {
 		ca_clear_subscription(evToClear);
 	}
+	if (args.op == CA_OP_CONN_UP) {
+		pvItem->releaseConnectWaiters();
+	}
+	if (args.op == CA_OP_CONN_UP && !pvItem->parent) {
+		g.updatePvMetadata(pvName, dbrType, nElems);
+	}
+	if (args.op == CA_OP_CONN_UP && pvItem->isPrefetchWanted() && !g.bCaLabPolling) {
+		// Preconnected PV: start the monitor now so the first read already has a value.
+		// Polling mode reads with explicit gets and never subscribes.
+		subscribePv(pvItem);
+	}
+	if (args.op == CA_OP_CONN_UP && pvItem->isCtrlMetadataWanted()) {
+		subscribeCtrlMetadata(pvItem);
+	}
+	if (args.op == CA_OP_CONN_UP && pvItem->isStaticField()) {
+		// Static fields are re-read once per (re)connect.
+		fetchPvOnce(pvItem);
+	}
 	g.removePendingConnection(pvItem);
 	g.notify();
 
@@ -3979,19 +5703,17 @@ void valueChanged(struct event_handler_args args) {
 	task.nElems = nElems;
 	task.errorCode = statusCode;
 
+	// A one-shot get of a static field that delivers no value must be issued again on the next read.
+	auto retryStaticFetch = [&args] {
+		if (args.usr) static_cast<PVItem*>(args.usr)->clearStaticFetchIssued();
+	};
+
 	// Only copy data if the status is OK and the pointer is valid.
 	if (statusCode == ECA_NORMAL && args.dbr) {
-		size_t elemSize = 0;
-		switch (type) {
-		case DBR_CHAR:    case DBR_TIME_CHAR:    elemSize = sizeof(dbr_char_t);   break;
-		case DBR_SHORT:   case DBR_TIME_SHORT:   elemSize = sizeof(dbr_short_t);  break;
-		case DBR_LONG:    case DBR_TIME_LONG:    elemSize = sizeof(dbr_long_t);   break;
-		case DBR_FLOAT:   case DBR_TIME_FLOAT:   elemSize = sizeof(dbr_float_t);  break;
-		case DBR_DOUBLE:  case DBR_TIME_DOUBLE:  elemSize = sizeof(dbr_double_t); break;
-		case DBR_ENUM:    case DBR_TIME_ENUM:    elemSize = sizeof(dbr_enum_t);   break;
-		case DBR_STRING:  case DBR_TIME_STRING:  elemSize = MAX_STRING_SIZE;      break;
-		default:
+		const size_t elemSize = dbrValueElementSize(type);
+		if (elemSize == 0) {
 			CaLabDbgPrintf("valueChanged: Unknown DBR-type %d", type);
+			retryStaticFetch();
 			return;
 		}
 
@@ -3999,6 +5721,7 @@ void valueChanged(struct event_handler_args args) {
 		void* copy = malloc(dataBytes);
 		if (!copy) {
 			CaLabDbgPrintf("valueChanged: malloc(%u) failed", (unsigned)dataBytes);
+			retryStaticFetch();
 			return;
 		}
 		memcpy(copy, dbr_value_ptr(args.dbr, args.type), dataBytes);
@@ -4006,6 +5729,7 @@ void valueChanged(struct event_handler_args args) {
 		task.dataCopy = copy;
 	}
 	else if (statusCode != ECA_NORMAL) {
+		retryStaticFetch();
 		// Set the error on the PV immediately and log it.
 		if (args.usr) {
 			PVItem* pvItem = static_cast<PVItem*>(args.usr);
@@ -4031,27 +5755,7 @@ void valueChanged(struct event_handler_args args) {
 	}
 
 	enqueueTask(std::move(task));
-
-	// If this is an ENUM PV and its enum labels have not been fetched yet, request them now.
-	if (args.usr && args.status == ECA_NORMAL) {
-		PVItem* pvItem = static_cast<PVItem*>(args.usr);
-		// Use the field type from the channel for robustness.
-		short fieldType = ca_field_type(args.chid);
-		if ((pvItem->getDbrType() == DBF_ENUM || fieldType == DBF_ENUM)) {
-			// Only request labels if we don't have them yet and no request is in-flight.
-			const auto& labels = pvItem->getEnumStrings();
-			if (labels.empty() && pvItem->tryMarkEnumFetchRequested()) {
-				g.addPendingConnection(pvItem);
-				int rc = ca_array_get_callback(DBR_CTRL_ENUM, 1, args.chid, enumInfoChanged, pvItem);
-				if (rc != ECA_NORMAL) {
-					pvItem->setErrorCode(rc);
-					pvItem->clearEnumFetchRequested();
-					g.removePendingConnection(pvItem);
-					CaLabDbgPrintf("Info: enum metadata request for %s deferred: %s", pvItem->getName().c_str(), ca_message_safe(rc));
-				}
-			}
-		}
-	}
+	requestEnumLabels(args);
 }
 
 void enumInfoChanged(struct event_handler_args args) {
@@ -4059,7 +5763,17 @@ void enumInfoChanged(struct event_handler_args args) {
 	if (pvItem) {
 		dbr_ctrl_enum* enumValue = (dbr_ctrl_enum*)args.dbr;
 		if (enumValue) {
+			const bool hadCachedLabels = pvItem->hasCachedEnumStrings();
+			std::vector<std::string> cachedLabels;
+			if (hadCachedLabels) cachedLabels = pvItem->getEnumStrings();
 			pvItem->setEnumValue(static_cast<const dbr_ctrl_enum*>(args.dbr));
+			if (hadCachedLabels && cachedLabels != pvItem->getEnumStrings()) {
+				// Labels from the cache file were stale; make readers pick up the new ones.
+				pvItem->updateChangeHash();
+			}
+			if (!pvItem->parent) {
+				Globals::getInstance().updatePvEnumStrings(pvItem->getName(), pvItem->getEnumStrings());
+			}
 		}
 		// Enum labels have arrived; allow future refreshes.
 		pvItem->clearEnumFetchRequested();
@@ -4069,6 +5783,34 @@ void enumInfoChanged(struct event_handler_args args) {
 	}
 }
 
+void ctrlMetadataChanged(struct event_handler_args args) {
+	Globals& g = Globals::getInstance();
+	if (g.stopped.load()) return;
+	PVItem* pvItem = static_cast<PVItem*>(args.usr);
+	if (!pvItem || args.status != ECA_NORMAL || !args.dbr) return;
+	if (args.type == DBR_CTRL_ENUM) {
+		pvItem->setCtrlMetadata(static_cast<const dbr_ctrl_enum*>(args.dbr));
+	}
+	else if (args.type == DBR_CTRL_DOUBLE) {
+		pvItem->setCtrlMetadata(static_cast<const dbr_ctrl_double*>(args.dbr));
+	}
+	postEventForPv(pvItem->getName());
+	g.notify();
+}
+
+void subscribeCtrlMetadata(PVItem* pvItem) {
+	if (!pvItem) return;
+	std::lock_guard<std::mutex> lock(pvItem->ioMutex());
+	if (pvItem->propertyEventId || !pvItem->channelId || !pvItem->isConnected()) return;
+	const short dbfType = pvItem->getDbrType();
+	const chtype ctrlType = (dbfType == DBF_ENUM) ? DBR_CTRL_ENUM : DBR_CTRL_DOUBLE;
+	int rc = ca_create_subscription(ctrlType, 1, pvItem->channelId, DBE_PROPERTY, ctrlMetadataChanged, pvItem, &pvItem->propertyEventId);
+	if (rc != ECA_NORMAL) {
+		pvItem->propertyEventId = nullptr;
+		CaLabDbgPrintf("Warning: Could not subscribe control metadata for %s. %s", pvItem->getName().c_str(), ca_message_safe(rc));
+	}
+}
+
 
 // =================================================================================
 // Memory Management Helpers
@@ -4081,10 +5823,7 @@ MgErr DeleteStringArray(sStringArrayHdl array) {
 	if (err != noErr || !*array)
 		return err;
 	for (uInt32 i = 0; i < (*array)->dimSize; i++) {
-		if ((*array)->elt[i] && DSCheckHandle((*array)->elt[i]) == noErr) {
-			err += DSDisposeHandle((*array)->elt[i]);
-		}
-		(*array)->elt[i] = nullptr;
+		recycleLStrHandle((*array)->elt[i]);
 	}
 	if (array && DSCheckHandle(array) == noErr) {
 		err += DSDisposeHandle(array);
@@ -4095,26 +5834,18 @@ MgErr DeleteStringArray(sStringArrayHdl array) {
 
 MgErr CleanupResult(sResult* currentResult) {
 	MgErr err = noErr;
-	if (currentResult->PVName && DSCheckHandle(currentResult->PVName) == noErr)
-		err += DSDisposeHandle(currentResult->PVName);
-	currentResult->PVName = nullptr;
+	recycleLStrHandle(currentResult->PVName);
 	if (currentResult->StringValueArray && DSCheckHandle(currentResult->StringValueArray) == noErr)
 		err += DeleteStringArray(currentResult->StringValueArray);
 	currentResult->StringValueArray = nullptr;
 	if (currentResult->ValueNumberArray && DSCheckHandle(currentResult->ValueNumberArray) == noErr)
 		err += DSDisposeHandle(currentResult->ValueNumberArray);
 	currentResult->ValueNumberArray = nullptr;
-	if (currentResult->StatusString && DSCheckHandle(currentResult->StatusString) == noErr)
-		err += DSDisposeHandle(currentResult->StatusString);
-	currentResult->StatusString = nullptr;
+	recycleLStrHandle(currentResult->StatusString);
 	currentResult->StatusNumber = 0;
-	if (currentResult->SeverityString && DSCheckHandle(currentResult->SeverityString) == noErr)
-		err += DSDisposeHandle(currentResult->SeverityString);
-	currentResult->SeverityString = nullptr;
+	recycleLStrHandle(currentResult->SeverityString);
 	currentResult->SeverityNumber = 0;
-	if (currentResult->TimeStampString && DSCheckHandle(currentResult->TimeStampString) == noErr)
-		err += DSDisposeHandle(currentResult->TimeStampString);
-	currentResult->TimeStampString = nullptr;
+	recycleLStrHandle(currentResult->TimeStampString);
 	currentResult->TimeStampNumber = 0;
 	if (currentResult->FieldNameArray && DSCheckHandle(currentResult->FieldNameArray) == noErr)
 		err += DeleteStringArray(currentResult->FieldNameArray);
@@ -4122,9 +5853,7 @@ MgErr CleanupResult(sResult* currentResult) {
 	if (currentResult->FieldValueArray && DSCheckHandle(currentResult->FieldValueArray) == noErr)
 		err += DeleteStringArray(currentResult->FieldValueArray);
 	currentResult->FieldValueArray = nullptr;
-	if (currentResult->ErrorIO.source && DSCheckHandle(currentResult->ErrorIO.source) == noErr)
-		err += DSDisposeHandle(currentResult->ErrorIO.source);
-	currentResult->ErrorIO.source = nullptr;
+	recycleLStrHandle(currentResult->ErrorIO.source);
 	currentResult->ErrorIO.code = 0;
 	currentResult->ErrorIO.status = 0;
 	currentResult->valueArraySize = 0;
@@ -4306,12 +6035,7 @@ MgErr prepareOutputArrays(uInt32 nameCount, uInt32 maxNumberOfValues, int filter
 				if (!currentResult->StringValueArray || !*currentResult->StringValueArray ||
 					(*currentResult->StringValueArray)->dimSize != maxNumberOfValues) {
 
-					if (currentResult->StringValueArray) DeleteStringArray(currentResult->StringValueArray);
-					const size_t totalSize =
-						sizeof(sStringArray) +
-						(static_cast<size_t>(maxNumberOfValues) - 1) * sizeof(LStrHandle);
-					currentResult->StringValueArray = reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-					if (currentResult->StringValueArray) (*currentResult->StringValueArray)->dimSize = maxNumberOfValues;
+					resizeStringArray(currentResult->StringValueArray, maxNumberOfValues);
 				}
 			}
 
@@ -4402,46 +6126,173 @@ MgErr CaLabDbgPrintfD([[maybe_unused]] const char* format, ...) {
 	return done;
 }
 
+namespace {
+	// Recycled LStrHandles released by CleanupResult/DeleteStringArray, reused by setLVString.
+	// Bounded in count and per-handle size so a one-off large teardown does not pin memory;
+	// whatever is left is disposed when the background workers are stopped.
+	constexpr size_t kLStrPoolMax = 4096;
+	constexpr size_t kLStrPoolMaxHandleSize = 1024;
+	std::mutex g_lstrPoolMutex;
+	std::vector<LStrHandle> g_lstrPool;
+	std::atomic<bool> g_lstrPoolRegistered{ false };
+
+	void disposeLStrPool() {
+		std::vector<LStrHandle> handles;
+		{
+			std::lock_guard<std::mutex> lock(g_lstrPoolMutex);
+			handles.swap(g_lstrPool);
+		}
+		for (LStrHandle handle : handles) {
+			DSDisposeHandle(handle);
+		}
+		g_lstrPoolRegistered.store(false);
+	}
+
+	LStrHandle takeRecycledLStrHandle(size_t len) {
+		LStrHandle handle = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(g_lstrPoolMutex);
+			if (g_lstrPool.empty()) return nullptr;
+			handle = g_lstrPool.back();
+			g_lstrPool.pop_back();
+		}
+		const size_t needed = sizeof(int32) + len;
+		if (static_cast<size_t>(DSGetHandleSize(reinterpret_cast<UHandle>(handle))) < needed &&
+			DSSetHandleSize(handle, static_cast<uInt32>(needed)) != noErr) {
+			DSDisposeHandle(handle);
+			return nullptr;
+		}
+		return handle;
+	}
+}
+
+void recycleLStrHandle(LStrHandle& handle) {
+	if (!handle) return;
+	if (DSCheckHandle(handle) == noErr) {
+		bool pooled = false;
+		if (static_cast<size_t>(DSGetHandleSize(reinterpret_cast<UHandle>(handle))) <= kLStrPoolMaxHandleSize) {
+			std::lock_guard<std::mutex> lock(g_lstrPoolMutex);
+			if (g_lstrPool.size() < kLStrPoolMax) {
+				(*handle)->cnt = 0;
+				g_lstrPool.push_back(handle);
+				pooled = true;
+			}
+		}
+		if (!pooled) DSDisposeHandle(handle);
+		else if (!g_lstrPoolRegistered.exchange(true)) {
+			Globals::getInstance().registerBackgroundWorker("lstrPool", [] { disposeLStrPool(); });
+		}
+	}
+	handle = nullptr;
+}
+
+MgErr resizeStringArray(sStringArrayHdl& array, uInt32 count) {
+	const size_t totalSize =
+		sizeof(sStringArray) +                                              // header + 1 element
+		(static_cast<size_t>(count > 0 ? count : 1) - 1) * sizeof(LStrHandle); // remaining elements
+	if (!array || !*array) {
+		array = reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
+		if (!array) return mFullErr;
+		(*array)->dimSize = count;
+		return noErr;
+	}
+	const uInt32 oldCount = static_cast<uInt32>((*array)->dimSize);
+	if (count == oldCount) return noErr;
+	if (count < oldCount) {
+		// Shrink in place: keep the handle, recycle surplus element strings.
+		for (uInt32 i = count; i < oldCount; ++i) {
+			recycleLStrHandle((*array)->elt[i]);
+		}
+	}
+	else {
+		if (static_cast<size_t>(DSGetHandleSize(reinterpret_cast<UHandle>(array))) < totalSize) {
+			MgErr err = DSSetHandleSize(array, static_cast<uInt32>(totalSize));
+			if (err != noErr) return err;
+		}
+		for (uInt32 i = oldCount; i < count; ++i) {
+			(*array)->elt[i] = nullptr;
+		}
+	}
+	(*array)->dimSize = count;
+	return noErr;
+}
+
 void setLVString(LStrHandle& handle, const std::string& text) {
 	MgErr err = noErr;
 	size_t len = text.size();
 	if (!handle) {
-		handle = (LStrHandle)DSNewHandle(static_cast<uInt32>(sizeof(int32) + len));
+		handle = takeRecycledLStrHandle(len);
+		if (!handle) {
+			handle = (LStrHandle)DSNewHandle(static_cast<uInt32>(sizeof(int32) + len));
+		}
 		if (!handle) return;
 	}
 	else {
-		err = DSSetHandleSize(handle, static_cast<uInt32>(sizeof(int32) + len));
-		if (err != noErr) return;
+		const size_t oldLen = static_cast<size_t>((*handle)->cnt);
+		// Unchanged text: nothing to do, no memory manager call.
+		if (oldLen == len && (len == 0 || memcmp((*handle)->str, text.data(), len) == 0)) {
+			return;
+		}
+		// Only grow the handle when the current capacity is too small.
+		if (len > oldLen && static_cast<size_t>(DSGetHandleSize(reinterpret_cast<UHandle>(handle))) < sizeof(int32) + len) {
+			err = DSSetHandleSize(handle, static_cast<uInt32>(sizeof(int32) + len));
+			if (err != noErr) return;
+		}
 	}
 	(*handle)->cnt = static_cast<int32>(len);
 	if (len)
 		memcpy((*handle)->str, text.data(), len);
 }
 
-void fillResultFromPv(PVItem* pvItem, sResult* target) {
-	if (!pvItem || !target) return;
+void snapshotPv(PVItem* pvItem, PvResultSnapshot& out) {
+	if (!pvItem) return;
+
+	out.name = pvItem->getName();
+	pvItem->dbrValue2String(out.stringValues);
+	out.numberValues.resize(pvItem->getNumberOfValues());
+	out.numberValues.resize(pvItem->dbrValue2Double(out.numberValues.data(), static_cast<uInt32>(out.numberValues.size())));
+
+	// Status/severity/timestamp
+	out.statusString = pvItem->getStatusAsString();
+	out.severityString = pvItem->getSeverityAsString();
+	out.timeStampString = pvItem->getTimestampAsString();
+	out.statusNumber = pvItem->getStatus();
+	out.severityNumber = pvItem->getSeverity();
+	out.timeStampNumber = pvItem->getTimestamp();
+
+	// Fields: names and values from parent's cache.
+	const auto& fields = pvItem->getFields();
+	out.fieldNames.resize(fields.size());
+	out.fieldValues.resize(fields.size());
+	for (size_t i = 0; i < fields.size(); ++i) {
+		out.fieldNames[i] = fields[i].first;
+		if (!pvItem->tryGetFieldString_callerLocked(fields[i].first, out.fieldValues[i])) {
+			out.fieldValues[i].clear();
+		}
+	}
+
+	// ErrorIO from PVItem
+	const int err = pvItem->getErrorCode();
+	out.errorCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
+	out.errorString = pvItem->getErrorAsString();
+}
 
-	setLVString(target->PVName, pvItem->getName());
-	auto strValues = pvItem->dbrValue2String();
-	auto numValues = pvItem->dbrValue2Double();
+void fillResultFromSnapshot(const PvResultSnapshot& snapshot, sResult* target) {
+	if (!target) return;
+
+	setLVString(target->PVName, snapshot.name);
+	const auto& strValues = snapshot.stringValues;
+	const auto& numValues = snapshot.numberValues;
 
 	const uInt32 valueCount = static_cast<uInt32>(numValues.size());
 	target->valueArraySize = valueCount;
 
 	if (!strValues.empty()) {
 		if (!target->StringValueArray || !*target->StringValueArray || (*target->StringValueArray)->dimSize != valueCount) {
-			if (target->StringValueArray) DeleteStringArray(target->StringValueArray);
-			if (valueCount > 0) {
-				const size_t totalSize =
-					sizeof(sStringArray) +
-					(valueCount - 1) * sizeof(LStrHandle);
-				target->StringValueArray = 	reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-				if (target->StringValueArray)
-					(**target->StringValueArray).dimSize = valueCount;
-			}
+			resizeStringArray(target->StringValueArray, valueCount);
 		}
 		if (target->StringValueArray && *target->StringValueArray) {
-			for (uInt32 i = 0; i < valueCount; ++i) {
+			for (uInt32 i = 0; i < valueCount && i < strValues.size(); ++i) {
 				setLVString((*target->StringValueArray)->elt[i], strValues[i]);
 			}
 		}
@@ -4458,67 +6309,47 @@ void fillResultFromPv(PVItem* pvItem, sResult* target) {
 	}
 
 	// Status/severity/timestamp
-	setLVString(target->StatusString, pvItem->getStatusAsString());
-	setLVString(target->SeverityString, pvItem->getSeverityAsString());
-	setLVString(target->TimeStampString, pvItem->getTimestampAsString());
-	target->StatusNumber = pvItem->getStatus();
-	target->SeverityNumber = pvItem->getSeverity();
-	target->TimeStampNumber = pvItem->getTimestamp();
-
-	// Fields: names and values from parent's cache.
-	const auto& fields = pvItem->getFields();
-	if (!fields.empty()) {
-		const uInt32 n = static_cast<uInt32>(fields.size());
+	setLVString(target->StatusString, snapshot.statusString);
+	setLVString(target->SeverityString, snapshot.severityString);
+	setLVString(target->TimeStampString, snapshot.timeStampString);
+	target->StatusNumber = snapshot.statusNumber;
+	target->SeverityNumber = snapshot.severityNumber;
+	target->TimeStampNumber = snapshot.timeStampNumber;
+
+	// Fields
+	if (!snapshot.fieldNames.empty()) {
+		const uInt32 n = static_cast<uInt32>(snapshot.fieldNames.size());
 		if (!target->FieldNameArray || !*target->FieldNameArray || (*target->FieldNameArray)->dimSize != n) {
-			if (target->FieldNameArray) DeleteStringArray(target->FieldNameArray);
-			if (n > 0) {
-				const size_t totalSize =
-					sizeof(sStringArray) +                       // dimSize + 1 Element
-					(static_cast<size_t>(n) - 1) * sizeof(LStrHandle); // restliche Elemente
-				target->FieldNameArray = reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-				if (target->FieldNameArray)
-					(**target->FieldNameArray).dimSize = n;
-			}
+			resizeStringArray(target->FieldNameArray, n);
 
 		}
 		if (!target->FieldValueArray || !*target->FieldValueArray || (*target->FieldValueArray)->dimSize != n) {
-			if (target->FieldValueArray) DeleteStringArray(target->FieldValueArray);
-			if(n > 0) {
-				const size_t totalSize =
-					sizeof(sStringArray) +                       // dimSize + 1 Element
-					(static_cast<size_t>(n) - 1) * sizeof(LStrHandle); // restliche Elemente
-				target->FieldValueArray = reinterpret_cast<sStringArrayHdl>(DSNewHClr(static_cast<uInt32>(totalSize)));
-				if (target->FieldValueArray)
-					(**target->FieldValueArray).dimSize = n;
-			}
+			resizeStringArray(target->FieldValueArray, n);
 		}
 		for (uInt32 i = 0; i < n; ++i) {
-			const std::string& fieldName = fields[i].first;
 			if (!target->FieldNameArray || !*target->FieldNameArray || !target->FieldValueArray || !*target->FieldValueArray) break;
-			setLVString((*target->FieldNameArray)->elt[i], fieldName);
-			std::string fieldValue;
-			if (pvItem->tryGetFieldString_callerLocked(fieldName, fieldValue)) {
-				setLVString((*target->FieldValueArray)->elt[i], fieldValue);
-			}
-			else {
-				setLVString((*target->FieldValueArray)->elt[i], std::string());
-			}
+			setLVString((*target->FieldNameArray)->elt[i], snapshot.fieldNames[i]);
+			setLVString((*target->FieldValueArray)->elt[i], snapshot.fieldValues[i]);
 		}
 	}
 
-	// ErrorIO from PVItem
-	const int err = pvItem->getErrorCode();
-	const uInt32 lvCode = (err <= (int)ECA_NORMAL) ? 0u : static_cast<uInt32>(err) + ERROR_OFFSET;
-	if (target->ErrorIO.code == lvCode && target->ErrorIO.source && *target->ErrorIO.source && (*target->ErrorIO.source)->cnt) {
+	if (target->ErrorIO.code == snapshot.errorCode && target->ErrorIO.source && *target->ErrorIO.source && (*target->ErrorIO.source)->cnt) {
 		// No change; skip updating the string to avoid unnecessary memory operations.
 	}
 	else {
-		target->ErrorIO.code = lvCode;
+		target->ErrorIO.code = snapshot.errorCode;
 		target->ErrorIO.status = 0;
-		setLVString(target->ErrorIO.source, pvItem->getErrorAsString());
+		setLVString(target->ErrorIO.source, snapshot.errorString);
 	}
 }
 
+void fillResultFromPv(PVItem* pvItem, sResult* target) {
+	if (!pvItem || !target) return;
+	PvResultSnapshot snapshot;
+	snapshotPv(pvItem, snapshot);
+	fillResultFromSnapshot(snapshot, target);
+}
+
 /**
  * @brief Collects environment and version information.
  * @return A vector of key-value pairs representing the information.
@@ -4556,10 +6387,29 @@ std::vector<std::pair<std::string, std::string>> collectEnvironmentInfo() {
 	// CALab Environment Variables
 	const char* calabPolling = getenv("CALAB_POLLING");
 	info.push_back({ "CALAB_POLLING", calabPolling ? calabPolling : "undefined (MDEL in use)" });
+	const char* calabPollingPipelined = getenv("CALAB_POLLING_PIPELINED");
+	info.push_back({ "CALAB_POLLING_PIPELINED", calabPollingPipelined ? calabPollingPipelined : "undefined (blocking polling reads)" });
+	const char* calabCtrlMetadata = getenv("CALAB_CTRL_METADATA");
+	info.push_back({ "CALAB_CTRL_METADATA", calabCtrlMetadata ? calabCtrlMetadata : "undefined (metadata fields use own channels)" });
+	const char* calabMetadataCache = getenv("CALAB_METADATA_CACHE");
+	info.push_back({ "CALAB_METADATA_CACHE", calabMetadataCache ? calabMetadataCache : "undefined (no persistent metadata cache)" });
 	const char* calabNoDbg = getenv("CALAB_NODBG");
 	info.push_back({ "CALAB_NODBG", calabNoDbg ? calabNoDbg : "undefined (no debug file path defined)" });
 	const char* calabSuppressExceptions = getenv("CALAB_CA_SUPPRESS_EXCEPTIONS");
 	info.push_back({ "CALAB_CA_SUPPRESS_EXCEPTIONS", calabSuppressExceptions ? calabSuppressExceptions : "undefined (CA exceptions are not suppressed)" });
+	const char* calabSuppressWrites = getenv("CALAB_SUPPRESS_UNCHANGED_WRITES");
+	info.push_back({ "CALAB_SUPPRESS_UNCHANGED_WRITES", calabSuppressWrites ? calabSuppressWrites : "undefined (every put is written)" });
+	const char* calabMaxEventRate = getenv("CALAB_MAX_EVENT_RATE");
+	info.push_back({ "CALAB_MAX_EVENT_RATE", calabMaxEventRate ? calabMaxEventRate : "undefined (no limit on total user events per second)" });
+
+	// Put statistics
+	Globals& g = Globals::getInstance();
+	info.push_back({ "PUTS ISSUED", std::to_string(g.putsIssued.load(std::memory_order_relaxed)) });
+	info.push_back({ "PUTS SUPPRESSED (UNCHANGED)", std::to_string(g.putsSuppressed.load(std::memory_order_relaxed)) });
+
+	// User event statistics
+	info.push_back({ "USER EVENTS POSTED", std::to_string(g.eventsPosted.load(std::memory_order_relaxed)) });
+	info.push_back({ "USER EVENTS COALESCED (RATE LIMIT)", std::to_string(g.eventsCoalesced.load(std::memory_order_relaxed)) });
 
 	return info;
 }
@@ -4652,11 +6502,10 @@ MgErr populateAllResultArray(sResultArrayHdl* ResultArray) {
 		if (!lock.isLocked()) return mgArgErr;
 		items.reserve(g.pvRegistry.size());
 		for (const auto& kv : g.pvRegistry) {
-			// Include only base PVs, not fields
+			// Include only base PVs, not fields (record types are resolved lazily, so use the parent link)
 			if (kv.second) {
 				PVItem* pv = kv.second.get();
-				std::string recordType = pv->getRecordType();
-				if (recordType.empty()) continue;
+				if (pv->parent != nullptr) continue;
 				items.push_back(pv);
 			}
 		}
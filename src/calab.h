@@ -14,7 +14,12 @@
 // - No symbols in this file modify behavior; changes are limited to comments.
 // =============================================================================
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include "epics_compat.h"
@@ -52,6 +57,19 @@ typedef struct { uInt32 dimSizes[2]; uint64_t elt[1]; } sLongArray2D;
 typedef sLongArray2D** sLongArray2DHdl;
 typedef struct { size_t dimSize; uint64_t elt[1]; } sLongArray;
 typedef sLongArray** sLongArrayHdl;
+/**
+ * 1D arrays of U32, I16 and booleans (flat per-PV metadata columns). Elements narrower than
+ * 8 bytes follow LabVIEW's int32 dimSize directly, so the header must not be size_t here.
+ */
+typedef struct { int32 dimSize; uInt32 elt[1]; } sUInt32Array;
+typedef sUInt32Array** sUInt32ArrayHdl;
+typedef struct { int32 dimSize; int16_t elt[1]; } sShortArray;
+typedef sShortArray** sShortArrayHdl;
+typedef struct { int32 dimSize; LVBoolean elt[1]; } sBooleanArray;
+typedef sBooleanArray** sBooleanArrayHdl;
+/** 2D array of I16, row-major (used for compact per-PV status/severity pairs). */
+typedef struct { uInt32 dimSizes[2]; int16_t elt[1]; } sShortArray2D;
+typedef sShortArray2D** sShortArray2DHdl;
 
 /**
  * @struct sError
@@ -181,12 +199,84 @@ extern "C" {
 	 */
 	EXPORT void getValue(sStringArrayHdl* PvNameArray, sStringArrayHdl* FieldNameArray, sLongArrayHdl* PvIndexArray, double Timeout, sResultArrayHdl* ResultArray, sStringArrayHdl* FirstStringValue, sDoubleArrayHdl* FirstDoubleValue, sDoubleArray2DHdl* DoubleValueArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* NoMDEL, LVBoolean* IsInitialized, int filter);
 
+	/**
+	 * @brief Numeric-only variant of getValue.
+	 *
+	 * Uses the same PV registry and change tracking as getValue but skips all string,
+	 * field and result-cluster work: values are converted straight from the DBR buffer
+	 * into the 2D double array, and only changed rows are rewritten on later calls.
+	 *
+	 * @param PvNameArray          Input PV names (required).
+	 * @param PvIndexArray         Opaque per-PV cache maintained across calls.
+	 * @param Timeout              Max seconds to wait for connections/values.
+	 * @param DoubleValueArray     2D numeric array [PV x value] (required).
+	 * @param AlarmArray           Optional: 2D I16 array [PV x 2] with {status, severity}.
+	 * @param CommunicationStatus  Set to 1 on recoverable failure, else 0.
+	 * @param FirstCall            In/out: signals first invocation from the VI.
+	 * @param IsInitialized        In/out: true when cache/arrays are initialized.
+	 */
+	EXPORT void getValueDoubles(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, double Timeout, sDoubleArray2DHdl* DoubleValueArray, sShortArray2DHdl* AlarmArray, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* IsInitialized);
+
+	/**
+	 * @brief Read alarm and timestamp metadata for all PVs as flat parallel arrays.
+	 *
+	 * Alternative to the sResult cluster for alarm panels: each output is a plain 1D
+	 * array indexed like PvNameArray, so no string handles are allocated per PV. Shares
+	 * the PvIndexArray cache semantics of getValueDoubles; only changed PVs are rewritten.
+	 * All outputs are optional (pass null to skip).
+	 *
+	 * @param PvNameArray          Input PV names (required).
+	 * @param PvIndexArray         Opaque per-PV cache maintained across calls.
+	 * @param Timeout              Max seconds to wait for connections/values.
+	 * @param Seconds              Timestamp seconds (same epoch as sResult.TimeStampNumber).
+	 * @param Nanoseconds          Timestamp nanoseconds.
+	 * @param Status               Alarm status codes.
+	 * @param Severity             Alarm severity codes.
+	 * @param ErrorCode            LabVIEW error code per PV (0 when OK, else CA status + ERROR_OFFSET).
+	 * @param Connected            Channel connection flag.
+	 * @param CommunicationStatus  Set to 1 on recoverable failure, else 0.
+	 * @param FirstCall            In/out: signals first invocation from the VI.
+	 * @param IsInitialized        In/out: true when cache/arrays are initialized.
+	 */
+	EXPORT void getValueMetadata(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, double Timeout, sUInt32ArrayHdl* Seconds, sUInt32ArrayHdl* Nanoseconds, sShortArrayHdl* Status, sShortArrayHdl* Severity, sUInt32ArrayHdl* ErrorCode, sBooleanArrayHdl* Connected, LVBoolean* CommunicationStatus, LVBoolean* FirstCall, LVBoolean* IsInitialized);
+
+	/**
+	 * @brief Block until a PV of the given index array has a new value.
+	 *
+	 * Sleeps on the change notifications of the PvIndexArray's dirty set instead of
+	 * polling getValue in a loop. Changes not yet read by getValue count as well, so the
+	 * call returns at once when some are pending. They are reported but not consumed; the
+	 * following getValue call still picks them up. In CALAB_POLLING mode the channels are
+	 * read in 100 ms rounds and only values that differ from the ones at call start count.
+	 *
+	 * @param PvIndexArray    PvIndexArray previously initialized by getValue (or a lean variant).
+	 * @param Timeout         Max seconds to wait.
+	 * @param ChangedIndices  Optional: sorted indices with pending changes (empty on timeout).
+	 * @param TimedOut        Set to 1 when nothing changed within Timeout, else 0.
+	 */
+	EXPORT void waitForChange(sLongArrayHdl* PvIndexArray, double Timeout, sUInt32ArrayHdl* ChangedIndices, LVBoolean* TimedOut);
+
+	/**
+	 * @brief Start connecting and subscribing PVs in the background and return at once.
+	 *
+	 * Meant for application startup: channels are created immediately and each PV is
+	 * subscribed as soon as it connects, so the first getValue/putValue finds connected
+	 * PVs with values instead of blocking on channel searches.
+	 *
+	 * @param PvNameArray  Optional: PV names to preconnect.
+	 * @param FilePath     Optional: text file with one PV name per line ('#' starts a comment).
+	 * @param PvCount      Optional: number of distinct PV names accepted.
+	 */
+	EXPORT void preconnectPVs(sStringArrayHdl* PvNameArray, LStrHandle FilePath, uInt32* PvCount);
+
     /**
 	* @brief Write values to EPICS PVs.
 	*
 	* Supports writing string or numeric arrays (row-major 2D). When wait4readback
 	* is true, the function waits for CA put-callbacks (or initial value callbacks)
-	* to confirm completion up to Timeout.
+	* to confirm completion up to Timeout. With CALAB_SUPPRESS_UNCHANGED_WRITES set, a put without
+	* wait4readback is skipped and reported as success while the PV is monitored and its monitored
+	* value equals the converted payload; by default the payload must also equal the last write.
 	*
 	* @param PvNameArray      PV names to write to (rows).
 	* @param PvIndexArray     Optional cache maintained across calls.
@@ -196,12 +286,63 @@ extern "C" {
 	* @param DataType         Type selector (see DataTypeEnum).
 	* @param Timeout          Max seconds to wait for connection/confirmation.
 	* @param wait4readback    If true, wait for completion callbacks.
-	* @param ErrorArray       Per-PV error results (allocated/filled on demand).
+	* @param ErrorArray       Per-PV error results (allocated/filled on demand). With wait4readback,
+	*                         each entry reports its own put completion (ECA_TIMEOUT if unconfirmed) and latency.
 	* @param Status           Aggregate success (false when any PV fails).
 	* @param FirstCall        In/out first call toggle for initialization.
 	*/
 	EXPORT void putValue(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, LVBoolean* Status, LVBoolean* FirstCall);
 
+	/**
+	* @brief Write values to EPICS PVs and verify them against the monitored readback.
+	*
+	* Same as putValue, but the PVs are subscribed and, after the writes (and their put-callbacks
+	* with wait4readback), the call waits until each PV's monitored value matches the written
+	* value within Tolerance. The readback is returned directly, so no getValue call is needed.
+	* String values written to DBF_STRING fields must match exactly.
+	*
+	* @param Tolerance        Max absolute difference between written and monitored value.
+	* @param ReadbackArray    Monitored values after verification (rows = PVs, NaN-padded).
+	* @param Verified         Per-PV flag: readback matched within Timeout. Unmatched PVs
+	*                         report ECA_TIMEOUT in ErrorArray.
+	* @see putValue for the remaining parameters.
+	*/
+	EXPORT void putValueVerify(sStringArrayHdl* PvNameArray, sLongArrayHdl* PvIndexArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, double Tolerance, LVBoolean* wait4readback, sErrorArrayHdl* ErrorArray, sDoubleArray2DHdl* ReadbackArray, sBooleanArrayHdl* Verified, LVBoolean* Status, LVBoolean* FirstCall);
+
+	/**
+	 * @brief Queue writes to EPICS PVs and return immediately with a completion token.
+	 *
+	 * Values are copied and handed to a CALab writer thread, which connects the PVs and
+	 * issues each put (with put-callback) as soon as its channel is up. The caller never
+	 * waits for connections or IOC confirmation; use putValueAsyncResult to collect them.
+	 *
+	 * @param PvNameArray         PV names to write to (rows).
+	 * @param StringValueArray2D  Source values when DataType=DT_STRING.
+	 * @param DoubleValueArray2D  Source values when DataType=DT_SINGLE/DT_DOUBLE.
+	 * @param LongValueArray2D    Source values when DataType is an integer type.
+	 * @param DataType            Type selector (see DataTypeEnum).
+	 * @param Timeout             Max seconds for connection and put confirmation.
+	 * @param Token               Completion token (0 if the request was rejected).
+	 */
+	EXPORT void putValueAsync(sStringArrayHdl* PvNameArray, sStringArray2DHdl* StringValueArray2D, sDoubleArray2DHdl* DoubleValueArray2D, sLongArray2DHdl* LongValueArray2D, uInt32 DataType, double Timeout, uInt32* Token);
+
+	/**
+	 * @brief Query or wait for the completion of a putValueAsync request.
+	 *
+	 * Reports per-PV results in PV order. A finished request is released after its
+	 * result has been returned with Done set; unknown tokens report Done and leave the arrays untouched.
+	 * Uncollected requests are released 60 s after their Timeout, or earliest-deadline first
+	 * once 1024 are held.
+	 *
+	 * @param Token      Token returned by putValueAsync.
+	 * @param Timeout    Max seconds to wait for completion (0 polls).
+	 * @param ErrorCode  LabVIEW error code per PV (0 when confirmed, ECA_IOINPROGRESS + ERROR_OFFSET while
+	 *                   pending, else CA status + ERROR_OFFSET).
+	 * @param LatencyMs  Put-callback latency per PV in ms, -1 while pending or when not issued.
+	 * @param Done       Set to 1 when every put is confirmed, failed or timed out.
+	 */
+	EXPORT void putValueAsyncResult(uInt32 Token, double Timeout, sUInt32ArrayHdl* ErrorCode, sDoubleArrayHdl* LatencyMs, LVBoolean* Done);
+
 	/**
 	 * @brief Collect library/runtime diagnostic information and an optional PV snapshot.
 	 *
@@ -232,6 +373,18 @@ extern "C" {
 	// LabVIEW User Event Callbacks
 	EXPORT void addEvent(LVUserEventRef* RefNum, sResult* ResultPtr);
 	EXPORT void destroyEvent(LVUserEventRef* RefNum);
+	/**
+	 * @brief Limit the rate of user events posted for a registration.
+	 *
+	 * Updates arriving faster are coalesced: the latest PV state is delivered at the next
+	 * allowed slot. CALAB_MAX_EVENT_RATE additionally caps the total number of events per
+	 * second over all registrations; updates over that budget are coalesced the same way.
+	 *
+	 * @param RefNum   User event registered with addEvent; the rate also applies to PVs
+	 *                 added to it later, until destroyEvent.
+	 * @param MaxRate  Max events per second for each PV of this RefNum (0 = unlimited).
+	 */
+	EXPORT void setEventRate(LVUserEventRef* RefNum, double MaxRate);
 	EXPORT uInt32 getCounter();
 }
 
@@ -269,87 +422,207 @@ struct PVMetaInfo {
 	}
 };
 struct PvIndexEntry;
-namespace {
-	std::mutex g_entryRegistryMutex;
-	std::unordered_set<PvIndexEntry*> g_entryRegistry;
-
-	void registerEntry(PvIndexEntry* e) {
-		if (!e) return;
-		std::lock_guard<std::mutex> lk(g_entryRegistryMutex);
-		g_entryRegistry.insert(e);
+
+/**
+ * @namespace PvEntrySlots
+ * @brief Generation-tagged slot table that controls PvIndexEntry lifetime.
+ *
+ * PvIndexArray elements hold a token (slot index + generation) instead of a raw
+ * pointer. Each slot stores the entry pointer and a packed state word
+ * (generation | deleting | refs), so acquiring an entry is a CAS on the slot
+ * without any shared lock. Slots live in chunks that are never freed, which
+ * makes checking a stale token always safe; releasing a slot bumps its
+ * generation and thereby invalidates every token still referring to it.
+ */
+namespace PvEntrySlots {
+#if UINTPTR_MAX == 0xffffffffu
+	constexpr unsigned kIndexBits = 20;   // 1M slots, 12-bit generation tag
+#else
+	constexpr unsigned kIndexBits = 32;
+#endif
+	constexpr uintptr_t kIndexMask = (static_cast<uintptr_t>(1) << kIndexBits) - 1;
+	constexpr uint32_t kGenerationMask = static_cast<uint32_t>(UINTPTR_MAX >> kIndexBits);
+	constexpr unsigned kChunkBits = 12;
+	constexpr uint32_t kChunkSize = 1u << kChunkBits;
+	constexpr uint32_t kMaxSlots = (kIndexMask < (1u << 24)) ? static_cast<uint32_t>(kIndexMask) + 1 : (1u << 24);
+	constexpr uint32_t kMaxChunks = kMaxSlots / kChunkSize;
+
+	// Slot state word: generation in the upper 32 bits, deleting flag in bit 31, refs below.
+	constexpr uint64_t kDeleting = static_cast<uint64_t>(1) << 31;
+	constexpr uint64_t kRefMask = kDeleting - 1;
+
+	struct Slot {
+		std::atomic<uint64_t> state{ 0 };
+		std::atomic<PvIndexEntry*> entry{ nullptr };
+	};
+
+	struct Table {
+		std::atomic<Slot*> chunks[kMaxChunks] = {};
+		std::mutex allocMutex;          // guards freeList/next only; never taken on acquire
+		std::vector<uint32_t> freeList;
+		uint32_t next = 1;              // slot 0 is never used so token 0 means "empty"
+	};
+
+	inline Table& table() {
+		static Table t;
+		return t;
+	}
+
+	inline uintptr_t makeToken(uint32_t index, uint32_t generation) noexcept {
+		return (static_cast<uintptr_t>(generation & kGenerationMask) << kIndexBits) | static_cast<uintptr_t>(index);
+	}
+	inline uint32_t tokenIndex(uintptr_t token) noexcept {
+		return static_cast<uint32_t>(token & kIndexMask);
+	}
+	inline uint32_t tokenGeneration(uintptr_t token) noexcept {
+		return static_cast<uint32_t>(token >> kIndexBits) & kGenerationMask;
+	}
+	inline bool generationMatches(uint64_t state, uintptr_t token) noexcept {
+		return (static_cast<uint32_t>(state >> 32) & kGenerationMask) == tokenGeneration(token);
+	}
+
+	inline Slot* slotAt(uint32_t index) noexcept {
+		if (index == 0 || index >= kMaxSlots) return nullptr;
+		Slot* chunk = table().chunks[index >> kChunkBits].load(std::memory_order_acquire);
+		return chunk ? &chunk[index & (kChunkSize - 1)] : nullptr;
+	}
+
+	// Returns the slot a token refers to, or nullptr if the token is stale.
+	inline Slot* liveSlot(uintptr_t token) noexcept {
+		Slot* slot = slotAt(tokenIndex(token));
+		if (!slot || !generationMatches(slot->state.load(std::memory_order_acquire), token)) return nullptr;
+		return slot;
+	}
+
+	// Publish an entry in a free slot; returns its token (0 if the table is exhausted).
+	inline uintptr_t allocate(PvIndexEntry* entry) {
+		Table& t = table();
+		uint32_t index = 0;
+		{
+			std::lock_guard<std::mutex> lk(t.allocMutex);
+			if (!t.freeList.empty()) {
+				index = t.freeList.back();
+				t.freeList.pop_back();
+			}
+			else if (t.next < kMaxSlots) {
+				index = t.next++;
+				std::atomic<Slot*>& chunk = t.chunks[index >> kChunkBits];
+				if (!chunk.load(std::memory_order_relaxed)) {
+					chunk.store(new Slot[kChunkSize], std::memory_order_release);
+				}
+			}
+		}
+		Slot* slot = slotAt(index);
+		if (!slot) return 0;
+		slot->entry.store(entry, std::memory_order_release);
+		return makeToken(index, static_cast<uint32_t>(slot->state.load(std::memory_order_acquire) >> 32));
+	}
+
+	// Invalidate all tokens of a slot and return it to the free list.
+	inline void release(uintptr_t token) {
+		Slot* slot = liveSlot(token);
+		if (!slot) return;
+		const uint32_t nextGeneration = static_cast<uint32_t>(slot->state.load(std::memory_order_acquire) >> 32) + 1;
+		slot->entry.store(nullptr, std::memory_order_release);
+		slot->state.store(static_cast<uint64_t>(nextGeneration) << 32, std::memory_order_release);
+		Table& t = table();
+		std::lock_guard<std::mutex> lk(t.allocMutex);
+		t.freeList.push_back(tokenIndex(token));
+	}
+
+	// Take a usage reference; fails if the token is stale or the entry is being deleted.
+	inline bool tryAcquire(uintptr_t token) noexcept {
+		Slot* slot = slotAt(tokenIndex(token));
+		if (!slot) return false;
+		uint64_t state = slot->state.load(std::memory_order_relaxed);
+		for (;;) {
+			if (!generationMatches(state, token) || (state & kDeleting)) return false;
+			if ((state & kRefMask) == kRefMask) return false;
+			if (slot->state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+				return true;
+			}
+		}
+	}
+
+	inline void releaseRef(uintptr_t token) noexcept {
+		if (Slot* slot = slotAt(tokenIndex(token))) slot->state.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	inline void markDeleting(uintptr_t token) noexcept {
+		Slot* slot = slotAt(tokenIndex(token));
+		if (!slot) return;
+		uint64_t state = slot->state.load(std::memory_order_relaxed);
+		while (generationMatches(state, token) &&
+			!slot->state.compare_exchange_weak(state, state | kDeleting, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+		}
 	}
 
-	void unregisterEntry(PvIndexEntry* e) {
-		if (!e) return;
-		std::lock_guard<std::mutex> lk(g_entryRegistryMutex);
-		g_entryRegistry.erase(e);
+	inline uint32_t currentRefs(uintptr_t token) noexcept {
+		Slot* slot = liveSlot(token);
+		return slot ? static_cast<uint32_t>(slot->state.load(std::memory_order_acquire) & kRefMask) : 0;
 	}
 
-	static inline bool isLiveEntry(PvIndexEntry* e) {
-		if (!e) return false;
-		std::lock_guard<std::mutex> lk(g_entryRegistryMutex);
-		return g_entryRegistry.find(e) != g_entryRegistry.end();
+	// Resolve a token to its entry without taking a reference (nullptr if stale).
+	inline PvIndexEntry* lookup(uintptr_t token) noexcept {
+		Slot* slot = liveSlot(token);
+		return slot ? slot->entry.load(std::memory_order_acquire) : nullptr;
 	}
 }
+
 /**
  * @struct PvIndexEntry
  * @brief Entry stored in PvIndexArray: links a PVItem to its PVMetaInfo.
  *
  * Added:
- *  - internal atomic refcount to allow safe concurrent readers
- *  - deletion marker to prevent new acquirers while an entry is being reclaimed
+ *  - slot token (PvEntrySlots) holding the refcount and deletion marker, so
+ *    concurrent readers can acquire the entry without a global lock
+ *  - shared dirty set of the owning PvIndexArray (changed indices since last read)
  *
  * Usage:
+ *  - PvIndexArray elements store token(), never the entry address.
  *  - Readers should call try_acquire() before using the entry and release()
  *    afterwards.
- *  - Deleter sets deleting=true and waits for refs==0 before deleting.
+ *  - Deleter calls mark_deleting() and waits for refs==0 before deleting.
  */
 struct PvIndexEntry {
 	PVItem* pvItem;
 	PVMetaInfo* metaInfo;
+	std::shared_ptr<PvDirtySet> dirtySet;
 
-	// Internal lifetime control for safe concurrent access
-	std::atomic<uint32_t> refs{ 0 };
-	std::atomic<bool> deleting{ false };
-
-	PvIndexEntry(PVItem* item, PVMetaInfo* meta)
-		: pvItem(item), metaInfo(meta) {
-		registerEntry(this);
+	PvIndexEntry(PVItem* item, PVMetaInfo* meta, std::shared_ptr<PvDirtySet> dirty = nullptr)
+		: pvItem(item), metaInfo(meta), dirtySet(std::move(dirty)) {
+		token_ = PvEntrySlots::allocate(this);
 	}
 
 	~PvIndexEntry() {
-		unregisterEntry(this);
+		PvEntrySlots::release(token_);
 	}
 
+	// Token to store in the PvIndexArray element (0 if no slot was available).
+	uintptr_t token() const noexcept { return token_; }
+
 	// Try to acquire a usage reference. Returns false if entry is being deleted.
 	bool try_acquire() noexcept {
-		uint32_t old = refs.load(std::memory_order_relaxed);
-		for (;;) {
-			// If deletion in progress, refuse to acquire.
-			if (deleting.load(std::memory_order_acquire)) {
-				return false;
-			}
-			if (refs.compare_exchange_weak(old, old + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
-				return true;
-			}
-			// compare_exchange_weak updates old; loop and retry.
-		}
+		return PvEntrySlots::tryAcquire(token_);
 	}
 
 	// Release a previously acquired reference.
 	void release() noexcept {
-		refs.fetch_sub(1, std::memory_order_acq_rel);
+		PvEntrySlots::releaseRef(token_);
 	}
 
 	// Mark entry for deletion so new acquirers fail.
 	void mark_deleting() noexcept {
-		deleting.store(true, std::memory_order_release);
+		PvEntrySlots::markDeleting(token_);
 	}
 
 	// Return current refcount (for waiting in deleter).
 	uint32_t current_refs() const noexcept {
-		return refs.load(std::memory_order_acquire);
+		return PvEntrySlots::currentRefs(token_);
 	}
+
+private:
+	uintptr_t token_ = 0;
 };
 
 /**
@@ -400,9 +673,54 @@ MgErr CaLabDbgPrintfD(const char* format, ...);
 TH_REENTRANT EXTERNC MgErr _FUNCC DbgPrintfv(const char* buf, va_list args);
 
 // Memory Management Helpers
-/** Set a LabVIEW string handle to the specified text (allocates/resizes as needed). */
+/**
+ * Set a LabVIEW string handle to the specified text.
+ * Unchanged text is left untouched; the handle only grows when its capacity is too
+ * small, and a null handle is taken from the recycle pool before allocating.
+ */
 void setLVString(LStrHandle& handle, const std::string& text);
 
+/** Return a string handle to the recycle pool (disposed if the pool is full) and null it. */
+void recycleLStrHandle(LStrHandle& handle);
+
+/**
+ * @brief Resize a LabVIEW string array in place, keeping existing element handles.
+ * Surplus elements are recycled, new elements start as null handles.
+ * @param array String array handle (allocated if null).
+ * @param count New number of elements.
+ * @return LabVIEW memory manager error code (noErr on success).
+ */
+MgErr resizeStringArray(sStringArrayHdl& array, uInt32 count);
+
+/**
+ * @struct PvResultSnapshot
+ * @brief Converted and formatted state of a PVItem, ready to be copied into sResult clusters.
+ *
+ * Lets postEventForPv convert a PV once per update and share the result across all
+ * subscribers of that PV.
+ */
+struct PvResultSnapshot {
+	std::string name;
+	std::vector<std::string> stringValues;
+	std::vector<double> numberValues;
+	std::string statusString;
+	std::string severityString;
+	std::string timeStampString;
+	int16_t statusNumber = 0;
+	int16_t severityNumber = 0;
+	uInt32 timeStampNumber = 0;
+	std::vector<std::string> fieldNames;
+	std::vector<std::string> fieldValues;
+	uInt32 errorCode = 0;
+	std::string errorString;
+};
+
+/** Capture the state of a PVItem into a snapshot (caller holds the PV's ioMutex). */
+void snapshotPv(PVItem* pvItem, PvResultSnapshot& out);
+
+/** Copy a snapshot into an sResult instance. */
+void fillResultFromSnapshot(const PvResultSnapshot& snapshot, sResult* target);
+
 /** Fill an sResult instance from a PVItem (values, status, severity, timestamp) */
 void fillResultFromPv(PVItem* pvItem, sResult* target);
 
@@ -483,12 +801,13 @@ bool setupPvIndexAndRegistry(
 	std::unordered_set<std::string>* uninitializedPvNames);
 
 /**
- * @brief Connect base PVs and their .RTYP channels, then subscribe.
- * Wait up to Timeout for .RTYP values to determine record types.
+ * @brief Connect base PVs and, if requested, their .RTYP channels, then subscribe.
+ * Wait up to Timeout for connections and .RTYP values to determine record types.
  * @param basePvNames Set of base PV names to process.
  * @param Timeout Maximum seconds to wait for .RTYP resolution.
+ * @param resolveRecordType If true, resolve record types (cache or .RTYP channel); needed for field lists only.
  */
-void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double Timeout, std::chrono::steady_clock::time_point endBy, LVBoolean* NoMDEL);
+void subscribeBasePVs(const std::unordered_set<std::string>& basePvNames, double Timeout, std::chrono::steady_clock::time_point endBy, LVBoolean* NoMDEL, bool resolveRecordType);
 
 /**
  * @brief Validate and connect approved field PVs (e.g., base.FIELD) after record type is known.
@@ -509,7 +828,7 @@ void waitForUninitializedPvs(const std::unordered_set<std::string>& basePvNames,
  * Adds created channels to the pending connection tracker.
  * @param pvItem The PVItem to connect.
  * @param filter Output selection bitmask (reserved for future use).
- * @param connectRtyp If true, also connect the .RTYP companion channel.
+ * @param connectRtyp If true, resolve the record type from the process-wide cache or the .RTYP companion channel.
  */
 void connectPv(PVItem* pvItem, bool connectRtyp = true);
 
@@ -519,6 +838,19 @@ void connectPv(PVItem* pvItem, bool connectRtyp = true);
  */
 void subscribePv(PVItem* pvItem);
 
+/**
+ * @brief Fetch a static field PV once with ca_array_get_callback instead of monitoring it.
+ * Issued at most once per connection; connectionChanged re-issues it after a reconnect.
+ * @param pvItem Field PV flagged as static.
+ */
+void fetchPvOnce(PVItem* pvItem);
+
+/** Subscribe a dynamic PV or fetch a static field PV once, depending on its classification. */
+void subscribeOrFetchPv(PVItem* pvItem);
+
+/** True when a connected PV still needs its monitor (dynamic) or one-shot get (static). Caller holds ioMutex. */
+bool needsSubscribeOrFetch_callerLocked(const PVItem* pvItem);
+
 /**
  * @brief Determine which PV indices have changed since the last read.
  * Optionally waits briefly for initial subscriptions to deliver a first value.
@@ -574,10 +906,26 @@ void valueChanged(struct event_handler_args args);
  */
 void enumInfoChanged(struct event_handler_args args);
 
+/**
+ * @brief Channel Access callback for DBE_PROPERTY updates of the base channel.
+ * @param args CA struct carrying DBR_CTRL_DOUBLE or DBR_CTRL_ENUM data.
+ */
+void ctrlMetadataChanged(struct event_handler_args args);
+
+/**
+ * @brief Subscribe the base channel for DBR_CTRL metadata (CALAB_CTRL_METADATA).
+ * No-op while the channel is not connected or a property subscription already exists.
+ * @param pvItem Base PV whose requested control fields are served from DBR_CTRL.
+ */
+void subscribeCtrlMetadata(PVItem* pvItem);
+
 // Event Posting Helper
 /** Post a LabVIEW user event for a given PV (thread-safe snapshotting of subscribers). */
 void postEventForPv(const std::string& pvName);
 
+/** Post coalesced events of rate-limited registrations whose next slot has come, oldest first (poll thread). */
+void postDueEvents();
+
 void executeSyncGet(PVItem* pvItem, std::chrono::steady_clock::time_point endBy);
 
 void getValueDirectSync(
@@ -65,12 +65,16 @@
   #define MAX_STRING_SIZE            40
   #define MAX_ENUM_STATES            16
   #define MAX_ENUM_STRING_SIZE       26
+  #define MAX_UNITS_SIZE             8
   #define epicsThreadPriorityBaseMax 91
   #define NO_ALARM                   0
 
   #define CA_K_ERROR    2
   #define CA_K_SUCCESS  1
   #define CA_K_WARNING  0
+  #define CA_K_INFO     3
+  #define CA_K_SEVERE   4
+  #define CA_K_FATAL    (CA_K_ERROR | CA_K_SEVERE)
   #define CA_V_MSG_NO   0x03
   #define CA_V_SEVERITY 0x00
   #define CA_M_MSG_NO   0x0000FFF8
@@ -148,6 +152,7 @@
 
   #define DBE_VALUE (1<<0)
   #define DBE_ALARM (1<<2)
+  #define DBE_PROPERTY (1<<3)
 
   typedef struct ca_client_context ca_client_context;
   typedef double      ca_real;
@@ -235,6 +240,7 @@
   #define DBR_TIME_LONG   19
   #define DBR_TIME_DOUBLE 20
   #define DBR_CTRL_ENUM   31
+  #define DBR_CTRL_DOUBLE 34
 
   #define ca_poll() ca_pend_event(1e-12)
 
@@ -242,6 +248,13 @@
       char strs[MAX_ENUM_STATES][MAX_ENUM_STRING_SIZE]; dbr_enum_t value; };
   struct dbr_ctrl_enum { dbr_short_t status; dbr_short_t severity; dbr_short_t no_str;
       char strs[MAX_ENUM_STATES][MAX_ENUM_STRING_SIZE]; dbr_enum_t value; };
+  struct dbr_ctrl_double { dbr_short_t status; dbr_short_t severity; dbr_short_t precision; dbr_short_t RISC_pad0;
+      char units[MAX_UNITS_SIZE];
+      dbr_double_t upper_disp_limit; dbr_double_t lower_disp_limit;
+      dbr_double_t upper_alarm_limit; dbr_double_t upper_warning_limit;
+      dbr_double_t lower_warning_limit; dbr_double_t lower_alarm_limit;
+      dbr_double_t upper_ctrl_limit; dbr_double_t lower_ctrl_limit;
+      dbr_double_t value; };
 
   struct dbr_time_string { dbr_short_t status; dbr_short_t severity; epicsTimeStamp stamp; dbr_short_t pad; dbr_string_t value; };
   struct dbr_time_short  { dbr_short_t status; dbr_short_t severity; epicsTimeStamp stamp; dbr_short_t pad; dbr_short_t value; };
@@ -1,6 +1,12 @@
 ﻿#include "globals.h"
 #include "TimeoutUniqueLock.h"
+#include "recordFields.h"
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string_view>
 #include <string>
 #include <cstring>
 #include <unordered_map>
@@ -60,6 +66,46 @@ static void InstallCaExceptionHandlerIfRequested() {
 	}
 #endif
 }
+
+// Verifies at compile time that the generated record field table supports binary search.
+constexpr bool isStrictlySorted(const std::string_view* names, std::size_t count) {
+	for (std::size_t i = 1; i < count; ++i) {
+		if (!(names[i - 1] < names[i])) return false;
+	}
+	return true;
+}
+
+constexpr bool recordFieldTableIsSorted() {
+	if (!isStrictlySorted(recordfields::kCommonFields, std::size(recordfields::kCommonFields))) return false;
+	for (std::size_t i = 0; i < std::size(recordfields::kRecordTypes); ++i) {
+		const auto& entry = recordfields::kRecordTypes[i];
+		if (i > 0 && !(recordfields::kRecordTypes[i - 1].name < entry.name)) return false;
+		if (!isStrictlySorted(entry.fields, entry.count)) return false;
+	}
+	return true;
+}
+static_assert(recordFieldTableIsSorted(), "recordFields.h is not sorted; regenerate it with tools/gen_record_fields.py");
+
+// Longest record type or field name accepted by recordFieldExists.
+constexpr std::size_t kMaxRecordNameLength = 64;
+
+// Cuts at the first NUL, trims whitespace and case-folds into buf without allocating.
+// Returns an empty view if the name does not fit.
+std::string_view normalizeRecordName(const std::string& s, char (&buf)[kMaxRecordNameLength], bool upper) {
+	size_t end = s.find('\0');
+	if (end == std::string::npos) end = s.size();
+	size_t start = 0;
+	while (start < end && std::isspace(static_cast<unsigned char>(s[start]))) ++start;
+	while (end > start && std::isspace(static_cast<unsigned char>(s[end - 1]))) --end;
+	if (end - start > kMaxRecordNameLength) {
+		return std::string_view();
+	}
+	for (size_t i = start; i < end; ++i) {
+		unsigned char c = static_cast<unsigned char>(s[i]);
+		buf[i - start] = static_cast<char>(upper ? std::toupper(c) : std::tolower(c));
+	}
+	return std::string_view(buf, end - start);
+}
 } // namespace
 
 Globals::Globals() {
@@ -70,6 +116,20 @@ Globals::Globals() {
 	else {
 		bCaLabPolling = false;
 	}
+	// Pipelined polling only makes sense on top of polling mode
+	bCaLabPollingPipelined = bCaLabPolling && getenv("CALAB_POLLING_PIPELINED") != nullptr;
+	// Serve control metadata fields from the base channel instead of per-field channels
+	bCaLabCtrlMetadata = getenv("CALAB_CTRL_METADATA") != nullptr;
+	// Skip puts the monitor shows as already applied; "monitor" does not require a matching last write
+	const char* suppressWrites = getenv("CALAB_SUPPRESS_UNCHANGED_WRITES");
+	bCaLabSuppressUnchangedWrites = suppressWrites != nullptr;
+	bCaLabSuppressMatchesMonitor = suppressWrites && std::strcmp(suppressWrites, "monitor") == 0;
+	// Cap the total user event rate of all addEvent registrations (events per second)
+	const char* maxEventRateEnv = getenv("CALAB_MAX_EVENT_RATE");
+	if (maxEventRateEnv) {
+		const double rate = std::atof(maxEventRateEnv);
+		maxEventRate = rate > 0.0 ? rate : 0.0;
+	}
 	// Set up a debug file if the CALAB_NODBG environment variable is defined
 	const char* tmp = getenv("CALAB_NODBG");
 	if (tmp) {
@@ -81,6 +141,13 @@ Globals::Globals() {
 			}
 		}
 	}
+	// Load PV metadata of earlier runs if a cache file is configured
+	const char* metadataCache = getenv("CALAB_METADATA_CACHE");
+	if (metadataCache && *metadataCache) {
+		metadataCachePath_ = metadataCache;
+		loadMetadataCache();
+		startMetadataWriter();
+	}
 	// Configure faster Channel Access search/connection timings before CA context init.
 	// Allow overrides via CALAB_CA_CONN_TMO / CALAB_CA_MAX_SEARCH_PERIOD; otherwise set safe defaults.
 	const char* caConnTmo = std::getenv("EPICS_CA_CONN_TMO");
@@ -206,6 +273,9 @@ Globals::Globals() {
 					}
 				}
 
+				// Deliver the latest state of rate-limited events whose next slot has come.
+				postDueEvents();
+
 				std::this_thread::sleep_for(std::chrono::milliseconds(10));
 			}
 			ca_detach_context();
@@ -225,6 +295,7 @@ Globals::~Globals() {
 	if (pollThread_.joinable()) {
 		pollThread_.join();
 	}
+	flushMetadataCache();
 	// A fixed delay to allow pending CA operations to complete. This is a fallback.
 	std::this_thread::sleep_for(std::chrono::milliseconds(1000));
 
@@ -344,252 +415,231 @@ void Globals::stopBackgroundWorkers() {
 // Checks if a field name is one of the standard fields common to all EPICS records.
 bool Globals::recordFieldIsCommonField(const std::string& fieldName) {
 	// Standard fields that exist in all EPICS records
-	static const std::unordered_set<std::string> commonFields = {
-		"NAME", "DESC", "ASG", "SCAN", "PINI", "PHAS", "EVNT", "TSE", "TSEL", "DTYP",
-		"DISV", "DISA", "SDIS", "MLOK", "MLIS", "DISP", "PROC", "STAT", "SEVR", "NSTA",
-		"NSEV", "ACKS", "ACKT", "DISS", "LCNT", "PACT", "PUTF", "RPRO", "PRIO", "TPRO",
-		"BKPT", "UDF", "UDFS", "TIME", "FLNK", "RTYP", "VAL"
+	return std::binary_search(std::begin(recordfields::kCommonFields), std::end(recordfields::kCommonFields),
+		std::string_view(fieldName));
+}
+
+bool Globals::recordFieldIsStatic(const std::string& fieldName) {
+	// Configuration/display fields that are set in the database and rarely touched at runtime
+	static const std::unordered_set<std::string> staticFields = {
+		"NAME", "DESC", "RTYP", "EGU", "PREC", "HOPR", "LOPR", "DRVH", "DRVL",
+		"NELM", "FTVL", "ZNAM", "ONAM",
+		"ZRST", "ONST", "TWST", "THST", "FRST", "FVST", "SXST", "SVST",
+		"EIST", "NIST", "TEST", "ELST", "TVST", "TTST", "FTST", "FFST"
 	};
-	return (commonFields.find(fieldName) != commonFields.end());
+	return (staticFields.find(fieldName) != staticFields.end());
+}
+
+void Globals::cacheRecordType(const std::string& pvName, const std::string& recordType) {
+	if (pvName.empty() || recordType.empty()) return;
+	{
+		std::lock_guard<std::shared_timed_mutex> lock(recordTypeCacheLock);
+		recordTypeCache[pvName] = recordType;
+		unverifiedRecordTypes_.erase(pvName);
+	}
+	if (metadataCachePath_.empty()) return;
+	std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+	PvMetadata& meta = metadataCache_[pvName];
+	if (meta.recordType != recordType) {
+		meta.recordType = recordType;
+		metadataCacheDirty_ = true;
+	}
+}
+
+bool Globals::cachedRecordType(const std::string& pvName, std::string& recordType, bool* unverified) const {
+	std::shared_lock<std::shared_timed_mutex> lock(recordTypeCacheLock);
+	auto it = recordTypeCache.find(pvName);
+	if (it == recordTypeCache.end()) return false;
+	recordType = it->second;
+	if (unverified) *unverified = unverifiedRecordTypes_.count(pvName) != 0;
+	return true;
+}
+
+void Globals::markRecordTypeUnverified(const std::string& pvName) {
+	std::lock_guard<std::shared_timed_mutex> lock(recordTypeCacheLock);
+	if (recordTypeCache.count(pvName) != 0) {
+		unverifiedRecordTypes_.insert(pvName);
+	}
+}
+
+void Globals::seedFromMetadataCache(PVItem* item) {
+	if (!item || metadataCachePath_.empty()) return;
+	PvMetadata meta;
+	{
+		std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+		auto it = metadataCache_.find(item->getName());
+		if (it == metadataCache_.end()) return;
+		meta = it->second;
+	}
+	std::lock_guard<std::mutex> lk(item->ioMutex());
+	if (item->isConnected()) return;
+	if (meta.dbfType >= 0) item->setDbrType(meta.dbfType);
+	if (meta.elementCount > 0) item->setNumberOfValues(meta.elementCount);
+	if (!meta.enumStrings.empty() && item->getEnumStrings().empty()) item->setCachedEnumStrings(meta.enumStrings);
+	if (!meta.recordType.empty() && item->getRecordType().empty()) item->setRecordType(meta.recordType);
+}
+
+void Globals::updatePvMetadata(const std::string& pvName, short dbfType, uInt32 elementCount) {
+	if (metadataCachePath_.empty() || pvName.empty()) return;
+	std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+	PvMetadata& meta = metadataCache_[pvName];
+	if (meta.dbfType != dbfType || meta.elementCount != elementCount) {
+		meta.dbfType = dbfType;
+		meta.elementCount = elementCount;
+		metadataCacheDirty_ = true;
+	}
+}
+
+void Globals::updatePvEnumStrings(const std::string& pvName, const std::vector<std::string>& enumStrings) {
+	if (metadataCachePath_.empty() || pvName.empty()) return;
+	std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+	PvMetadata& meta = metadataCache_[pvName];
+	if (meta.enumStrings != enumStrings) {
+		meta.enumStrings = enumStrings;
+		metadataCacheDirty_ = true;
+	}
+}
+
+// Cache file format: a comment header, then one line per base PV with tab-separated
+// name, DBF type, element count, record type and enum labels.
+void Globals::loadMetadataCache() {
+	std::ifstream in(metadataCachePath_);
+	if (!in) {
+		// First run: the file is created on the first flush.
+		return;
+	}
+	size_t loaded = 0;
+	std::string line;
+	while (std::getline(in, line)) {
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty() || line[0] == '#') continue;
+		std::vector<std::string> cols;
+		size_t start = 0;
+		for (;;) {
+			size_t tab = line.find('\t', start);
+			cols.emplace_back(line, start, tab == std::string::npos ? std::string::npos : tab - start);
+			if (tab == std::string::npos) break;
+			start = tab + 1;
+		}
+		if (cols.size() < 4 || cols[0].empty()) continue;
+		PvMetadata meta;
+		meta.dbfType = static_cast<short>(std::strtol(cols[1].c_str(), nullptr, 10));
+		meta.elementCount = static_cast<uInt32>(std::strtoul(cols[2].c_str(), nullptr, 10));
+		meta.recordType = cols[3];
+		meta.enumStrings.assign(cols.begin() + 4, cols.end());
+		if (!meta.recordType.empty()) {
+			std::lock_guard<std::shared_timed_mutex> lock(recordTypeCacheLock);
+			recordTypeCache[cols[0]] = meta.recordType;
+			unverifiedRecordTypes_.insert(cols[0]);
+		}
+		std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+		metadataCache_[cols[0]] = std::move(meta);
+		++loaded;
+	}
+	CaLabDbgPrintf("Info: loaded metadata of %u PVs from %s", static_cast<unsigned>(loaded), metadataCachePath_.c_str());
+}
+
+void Globals::startMetadataWriter() {
+	metadataWriter_ = std::thread([this] {
+		std::unique_lock<std::mutex> lock(metadataWriterMutex_);
+		while (!metadataWriterStop_) {
+			metadataWriterCv_.wait_for(lock, std::chrono::seconds(5), [this] { return metadataWriterStop_; });
+			if (metadataWriterStop_) break;
+			lock.unlock();
+			flushMetadataCache();
+			lock.lock();
+		}
+		});
+	registerBackgroundWorker("metadataCacheWriter", [this] { stopMetadataWriter(); });
+}
+
+void Globals::stopMetadataWriter() {
+	{
+		std::lock_guard<std::mutex> lock(metadataWriterMutex_);
+		metadataWriterStop_ = true;
+	}
+	metadataWriterCv_.notify_all();
+	if (metadataWriter_.joinable()) {
+		metadataWriter_.join();
+	}
+}
+
+void Globals::flushMetadataCache() {
+	if (metadataCachePath_.empty()) return;
+	std::unordered_map<std::string, PvMetadata> snapshot;
+	{
+		std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+		if (!metadataCacheDirty_) return;
+		snapshot = metadataCache_;
+		metadataCacheDirty_ = false;
+	}
+	// Tabs and line breaks would break the line format; EPICS names and labels don't use them.
+	auto clean = [](std::string s) {
+		for (auto& c : s) if (c == '\t' || c == '\n' || c == '\r') c = ' ';
+		return s;
+		};
+	const std::string tmpPath = metadataCachePath_ + ".tmp";
+	bool ok = false;
+	{
+		std::ofstream out(tmpPath, std::ios::trunc);
+		if (out) {
+			out << "# CALab PV metadata cache v1: name, DBF type, element count, record type, enum labels\n";
+			for (const auto& kv : snapshot) {
+				const PvMetadata& meta = kv.second;
+				out << clean(kv.first) << '\t' << meta.dbfType << '\t' << meta.elementCount << '\t' << clean(meta.recordType);
+				for (const auto& label : meta.enumStrings) {
+					out << '\t' << clean(label);
+				}
+				out << '\n';
+			}
+			ok = static_cast<bool>(out.flush());
+		}
+	}
+	// Replace the old file only after the new one is complete.
+	if (ok) {
+		std::remove(metadataCachePath_.c_str());
+		ok = std::rename(tmpPath.c_str(), metadataCachePath_.c_str()) == 0;
+	}
+	if (!ok) {
+		CaLabDbgPrintf("Warning: Could not write metadata cache %s", metadataCachePath_.c_str());
+		std::lock_guard<std::mutex> lock(metadataCacheMutex_);
+		metadataCacheDirty_ = true;
+	}
 }
 
 /**
  * @brief Checks whether a field name exists for a specific EPICS record type.
  *
  * This function validates if the specified field is valid for the given EPICS record type
- * by checking against a comprehensive, hardcoded list of fields derived from EPICS base
- * and common modules. It includes a cache for performance.
+ * by binary search in the sorted tables of recordFields.h, generated from the EPICS base
+ * dbd files by tools/gen_record_fields.py. Lookups need no locking or allocation.
  *
  * @param recordTypeStr The EPICS record type (e.g., "ai", "stringin", "calc").
  * @param fieldName The field name to be checked.
  * @return bool True if the field exists for the record type, otherwise false.
  */
 bool Globals::recordFieldExists(const std::string& recordTypeStr, const std::string& fieldName) {
-	// Normalize inputs: strip embedded NULs/padding, trim whitespace, and fix case.
-	auto sanitize = [](std::string s) {
-		// Cut at first NUL if present.
-		size_t pos0 = s.find('\0');
-		if (pos0 != std::string::npos) s.resize(pos0);
-		// Trim whitespace from both ends.
-		auto isws = [](unsigned char c) { return std::isspace(c) != 0; };
-		size_t start = 0;
-		while (start < s.size() && isws(static_cast<unsigned char>(s[start]))) ++start;
-		size_t end = s.size();
-		while (end > start && isws(static_cast<unsigned char>(s[end - 1]))) --end;
-		if (start > 0 || end < s.size()) s = s.substr(start, end - start);
-		return s;
-		};
-
-	std::string rec = sanitize(recordTypeStr);
-	std::string fld = sanitize(fieldName);
-	// EPICS record types are conventionally lowercase, fields uppercase.
-	for (auto& c : rec) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-	for (auto& c : fld) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-
-	if (recordFieldIsCommonField(fld)) {
-		return true;
+	// Normalize inputs into stack buffers; EPICS record types are conventionally
+	// lowercase, fields uppercase.
+	char recBuf[kMaxRecordNameLength];
+	char fldBuf[kMaxRecordNameLength];
+	std::string_view rec = normalizeRecordName(recordTypeStr, recBuf, false);
+	std::string_view fld = normalizeRecordName(fieldName, fldBuf, true);
+	if (fld.empty()) {
+		return false;
 	}
 
-	// Record-specific fields based on the EPICS headers from epics-base and sscan module.
-	static std::unordered_map<std::string, std::unordered_set<std::string>> recordSpecificFields = {
-		{"ai", {
-			"ADEL", "AOFF", "ASLO", "EGU", "EGUF", "EGUL", "HIGH", "HIHI", "HOPR",
-			"HHSV", "HSV", "HYST", "INP", "LINR", "LOLO", "LOPR", "LOW", "LLSV",
-			"LSV", "MDEL", "PREC", "RVAL", "SIML", "SIMS", "SIOL", "SMOO", "SVAL"
-		}},
-		{"aai", {
-			"BPTR", "EGU", "FTVL", "HIGH", "HIHI", "HOPR", "HHSV", "HSV", "HYST",
-			"INP", "LOLO", "LOPR", "LOW", "LLSV", "LSV", "MDEL", "NELM", "NORD",
-			"PREC", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"ao", {
-			"ADEL", "DOL", "DRVH", "DRVL", "EGU", "EGUF", "EGUL", "HIGH", "HIHI",
-			"HOPR", "HHSV", "HSV", "HYST", "INIT", "IVOA", "IVOV", "LBRK", "LINR",
-			"LOLO", "LOPR", "LOW", "LLSV", "LSV", "MDEL", "OIF", "OMSL", "ORAW",
-			"ORBV", "OUT", "PBRK", "PREC", "RBV", "RVAL", "SIML", "SIMS", "SIOL",
-			"SVAL"
-		}},
-		{"aao", {
-			"BPTR", "DOL", "EGU", "FTVL", "HIGH", "HIHI", "HOPR", "HHSV", "HSV",
-			"HYST", "IVOA", "IVOV", "LOLO", "LOPR", "LOW", "LLSV", "LSV", "MDEL",
-			"NELM", "NORD", "OMSL", "OUT", "PREC", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"bi", {
-			"COSV", "INP", "MASK", "ONAM", "OSV", "RVAL", "SIML", "SIMS", "SIOL",
-			"SVAL", "ZNAM", "ZSV"
-		}},
-		{"bo", {
-			"COSV", "DOL", "HIGH", "IVOA", "IVOV", "MASK", "OMSL", "ONAM", "OSV",
-			"OUT", "RBV", "RVAL", "SIML", "SIMS", "SIOL", "SVAL", "ZNAM", "ZSV"
-		}},
-		{"mbbi", {
-			"COSV", "EISV", "EIST", "EIVL", "ELSV", "ELST", "ELVL", "FFSV", "FFST",
-			"FFVL", "FRSV", "FRST", "FRVL", "FTSV", "FTST", "FTVL", "FVSV", "FVST",
-			"FVVL", "INP", "MASK", "NISV", "NIST", "NIVL", "NOBT", "ONSV", "ONST",
-			"ONVL", "RVAL", "SHFT", "SIML", "SIMS", "SIOL", "SVAL", "SVSV", "SVST",
-			"SVVL", "SXSV", "SXST", "SXVL", "TESV", "TEST", "TEVL", "THSV", "THST",
-			"THVL", "TTSV", "TTST", "TTVL", "TVSV", "TVST", "TVVL", "TWSV", "TWST",
-			"TWVL", "ZRSV", "ZRST", "ZRVL"
-		}},
-		{"mbbo", {
-			"COSV", "DOL", "EISV", "EIST", "EIVL", "ELSV", "ELST", "ELVL", "FFSV",
-			"FFST", "FFVL", "FRSV", "FRST", "FRVL", "FTSV", "FTST", "FTVL", "FVSV",
-			"FVST", "FVVL", "IVOA", "IVOV", "MASK", "NISV", "NIST", "NIVL", "NOBT",
-			"OMSL", "ONSV", "ONST", "ONVL", "ORBV", "OUT", "RBV", "RVAL", "SHFT",
-			"SVSV", "SVST", "SVVL", "SXSV", "SXST", "SXVL", "TESV", "TEST", "TEVL",
-			"THSV", "THST", "THVL", "TTSV", "TTST", "TTVL", "TVSV", "TVST", "TVVL",
-			"TWSV", "TWST", "TWVL", "ZRSV", "ZRST", "ZRVL"
-		}},
-		{"stringin", {
-			"INP", "OVAL", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"stringout", {
-			"DOL", "IVOA", "IVOV", "OMSL", "OUT", "OVAL", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"longin", {
-			"EGU", "HIGH", "HIHI", "HOPR", "HHSV", "HSV", "HYST", "INP", "LOLO",
-			"LOPR", "LOW", "LLSV", "LSV", "MDEL", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"longout", {
-			"DOL", "DRVH", "DRVL", "EGU", "HIGH", "HIHI", "HOPR", "HHSV", "HSV",
-			"IVOA", "IVOV", "LOLO", "LOPR", "LOW", "LLSV", "LSV", "OMSL", "OUT"
-		}},
-		{"calc", {
-			"A", "AA", "ADEL", "B", "BB", "C", "CC", "CALC", "D", "DD", "DLYA",
-			"DOPT", "E", "EE", "EGU", "F", "FF", "G", "GG", "H", "HH", "HIGH",
-			"HIHI", "HOPR", "HHSV", "HSV", "HYST", "I", "II", "INPA", "INPB",
-			"INPC", "INPD", "INPE", "INPF", "INPG", "INPH", "INPI", "INPJ",
-			"INPK", "INPL", "J", "JJ", "K", "KK", "L", "LL", "LOLO", "LOPR",
-			"LOW", "LLSV", "LSV", "MDEL", "OCAL", "ODLY", "OOPT", "OVAL", "PREC", "WAIT"
-		}},
-		{"calcout", {
-			"CALC", "DLYA", "DOL", "DOPT", "EGU", "HIGH", "HIHI", "HOPR", "HHSV",
-			"HSV", "INPA", "INPB", "INPC", "INPD", "INPE", "INPF", "INPG", "INPH",
-			"INPI", "INPJ", "INPK", "INPL", "IVOA", "IVOV", "LOLO", "LOPR", "LOW",
-			"LLSV", "LSV", "OCAL", "OOPT", "OUT", "OVAL", "PREC", "WAIT"
-		}},
-		{"waveform", {
-			"BPTR", "EGU", "FTVL", "HIGH", "HIHI", "HOPR", "HHSV", "HSV", "HYST",
-			"INP", "LOLO", "LOPR", "LOW", "LLSV", "LSV", "NELM", "NORD", "PREC",
-			"RARM", "RMOD", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"sseq", {
-			"ABRT", "BUSY", "DLY1", "DLY2", "DLY3", "DLY4", "DLY5", "DLY6", "DLY7",
-			"DLY8", "DLY9", "DLYA", "DO1", "DO2", "DO3", "DO4", "DO5", "DO6", "DO7",
-			"DO8", "DO9", "DOA", "DOL1", "DOL2", "DOL3", "DOL4", "DOL5", "DOL6",
-			"DOL7", "DOL8", "DOL9", "DOLA", "LNK1", "LNK2", "LNK3", "LNK4", "LNK5",
-			"LNK6", "LNK7", "LNK8", "LNK9", "LNKA", "PAUS", "PREC", "SELL", "SELM",
-			"STR1", "STR2", "STR3", "STR4", "STR5", "STR6", "STR7", "STR8", "STR9",
-			"STRA", "VERS"
-		}},
-		{"sscan", { // Fields from sscan module, may vary by version
-			"ACQM", "ACQS", "ACQT", "AERY", "AQR", "ATIME", "AWCT", "BSPV",
-			"BSWAIT", "BUSY", "CMND", "CPT", "CTIME", "DATA", "DDLY", "DIM",
-			"D01PV", "D02PV", "D03PV", "D04PV", "D05PV", "D06PV", "D07PV", "D08PV", "D09PV", "D10PV",
-			"D11PV", "D12PV", "D13PV", "D14PV", "D15PV", "D16PV", "D17PV", "D18PV", "D19PV", "D20PV",
-			"D21PV", "D22PV", "D23PV", "D24PV", "D25PV", "D26PV", "D27PV", "D28PV", "D29PV", "D30PV",
-			"D31PV", "D32PV", "D33PV", "D34PV", "D35PV", "D36PV", "D37PV", "D38PV", "D39PV", "D40PV",
-			"D41PV", "D42PV", "D43PV", "D44PV", "D45PV", "D46PV", "D47PV", "D48PV", "D49PV", "D50PV",
-			"D51PV", "D52PV", "D53PV", "D54PV", "D55PV", "D56PV", "D57PV", "D58PV", "D59PV", "D60PV",
-			"D61PV", "D62PV", "D63PV", "D64PV", "D65PV", "D66PV", "D67PV", "D68PV", "D69PV", "D70PV",
-			"D71PV", "D72PV", "D73PV", "D74PV", "D75PV", "EXSC", "FFL",
-			"FFO", "FNAM", "FNUM", "FPTS", "MPTS", "NDATTR", "NPTS", "P1AR",
-			"P1CR", "P1CV", "P1EP", "P1HR", "P1LR", "P1LV", "P1NP", "P1NV",
-			"P1PA", "P1PV", "P1RA", "P1SI", "P1SM", "P1SP", "P1WD", "P2AR",
-			"P2CR", "P2CV", "P2EP", "P2HR", "P2LR", "P2LV", "P2NP", "P2NV",
-			"P2PA", "P2PV", "P2RA", "P2SI", "P2SM", "P2SP", "P2WD", "P3AR",
-			"P3CR", "P3CV", "P3EP", "P3HR", "P3LR", "P3LV", "P3NP", "P3NV",
-			"P3PA", "P3PV", "P3RA", "P3SI", "P3SM", "P3SP", "P3WD", "P4AR",
-			"P4CR", "P4CV", "P4EP", "P4HR", "P4LR", "P4LV", "P4NP", "P4NV",
-			"P4PA", "P4PV", "P4RA", "P4SI", "P4SM", "P4SP", "P4WD", "PAME",
-			"PASM", "PAUS", "PDLY", "PREC", "PREA", "PTIME", "R1CV", "R1NV",
-			"R1PV", "R2CV", "R2NV", "R2PV", "R3CV", "R3NV", "R3PV", "R4CV",
-			"R4NV", "R4PV", "R5CV", "R5NV", "R5PV", "SMSG", "STIME", "STRATTR",
-			"T1CV", "T1NV", "T1PV", "T2CV", "T2NV", "T2PV", "T3CV", "T3NV",
-			"T3PV", "T4CV", "T4NV", "T4PV", "VERS", "WAIT", "WERR"
-		}},
-		{"busy", {
-			"INP", "ONAM", "OUT", "ZNAM"
-		}},
-		{"dfanout", { // Note: This is an old record, often replaced by fanout
-			"INP", "OUTA", "OUTB", "OUTC", "OUTD", "OUTE", "OUTF", "OUTG", "OUTH",
-			"SELL", "SELM"
-		}},
-		{"event", {
-			"INP", "OVAL", "SIML", "SIMS", "SIOL", "SVAL"
-		}},
-		{"fanout", {
-			"INP", "LNK0", "LNK1", "LNK2", "LNK3", "LNK4", "LNK5", "LNK6", "LNK7",
-			"LNK8", "LNK9", "LNKA", "LNKB", "LNKC", "LNKD", "LNKE", "LNKF", "SELL", "SELM"
-		}},
-		{"motor", { // Fields from the motor module, can vary significantly by version
-			"ACCL", "ADEL", "ALST", "ATHM", "BACC", "BDST", "BVEL", "CARD",
-			"CDIR", "CNEN", "DCOF", "DHLM", "DIFF", "DINP", "DIR", "DLLM",
-			"DLY", "DMOV", "DOL", "DRBV", "DVAL", "EGU", "ERES", "FOF",
-			"FOFF", "FRAC", "HHSV", "HIGH", "HIHI", "HLM", "HLS", "HLSV",
-			"HOME", "HOMF", "HOMR", "HOPR", "HSV", "HVEL", "ICOF", "INIT",
-			"JAR", "JOGF", "JOGR", "JVEL", "LDVL", "LLM", "LLS", "LLSV",
-			"LOCK", "LOLO", "LOPR", "LOW", "LRLV", "LRVL", "LSPG", "LSV",
-			"LVAL", "LVIO", "MDEL", "MIP", "MISS", "MLST", "MOVN", "MRES",
-			"MSTA", "NTM", "NTMF", "OFF", "OMSL", "OUT", "PCOF", "POST",
-			"PP", "PREC", "PREM", "RBV", "RCNT", "RDBD", "RDBL", "RDIF",
-			"REP", "RHLS", "RINP", "RLNK", "RLV", "RMOD", "RMP", "RRBV",
-			"RRES", "RSTM", "RTRY", "RVAL", "RVEL", "S", "SBAK", "SBAS", "SET",
-			"SMAX", "SPDB", "SPMG", "SREV", "STOO", "STOP", "STUP", "SUSE",
-			"SYNC", "TDIR", "TWF", "TWR", "TWV", "UEIP", "UREV", "URIP",
-			"VBAS", "VELO", "VERS", "VMAX", "VOF"
-		}},
-		{"sub", {
-			"BRSV", "INAM", "INPA", "INPB", "INPC", "INPD", "INPE", "INPF",
-			"INPG", "INPH", "INPI", "INPJ", "INPK", "INPL", "LFLG", "LNAM",
-			"OUTA", "OUTB", "OUTC", "OUTD", "OUTE", "OUTF", "OUTG", "OUTH",
-			"OUTI", "OUTJ", "OUTK", "OUTL", "SNAM", "SUBL", "SUBM"
-		}},
-		{"subArray", {
-			"BPTR", "EGU", "FTVL", "INP", "INDX", "LENG", "MALM", "NELM",
-			"NORD", "OUT", "PREC", "SUBL"
-		}},
-		{"compress", {
-			"ALG", "CVT", "HOPR", "HIHI", "HIGH", "HSV", "HHSV", "INP",
-			"LOPR", "LOLO", "LOW", "LSV", "LLSV", "NSAM", "NUSE", "OFF",
-			"RES", "SQUE"
-		}},
-		{"pid", { // PID control record from std support
-			"CVAL", "D", "DEAD", "DGAP", "DP", "DRVH", "DRVL", "DT", "EGU",
-			"ERR", "FBON", "HIGH", "HIHI", "HOPR", "I", "INP", "IVAL", "KD",
-			"KI", "KP", "LOLO", "LOPR", "LOW", "MAXI", "MDEL", "MID", "OIF",
-			"OMSL", "OUT", "P", "PVAL", "RBV", "STN", "SUM", "TMOD", "TRIG"
-		}}
-	};
-
-	// Cache for field-record combinations that have already been checked.
-	static std::unordered_map<std::string, bool> fieldCache;
-
-	// Create a key for the cache: "recordType.fieldName".
-	std::string cacheKey = rec + "." + fld;
-
-	// Check if this combination is already in the cache.
-	{
-		std::lock_guard<std::shared_timed_mutex> lock(fieldCacheLock);
-		auto cacheIt = fieldCache.find(cacheKey);
-		if (cacheIt != fieldCache.end()) {
-			return cacheIt->second;
-		}
+	if (std::binary_search(std::begin(recordfields::kCommonFields), std::end(recordfields::kCommonFields), fld)) {
+		return true;
 	}
 
-	// Check if the field exists in the specific record type's map entry.
-	bool exists = false;
-	auto recordIt = recordSpecificFields.find(rec);
-	if (recordIt != recordSpecificFields.end() &&
-		recordIt->second.find(fld) != recordIt->second.end()) {
-		exists = true;
-	}
-	// Update the cache with the result.
-	{
-		std::lock_guard<std::shared_timed_mutex> lock(fieldCacheLock);
-		fieldCache[cacheKey] = exists;
+	// Record-specific fields from the generated table (see tools/gen_record_fields.py).
+	auto recordIt = std::lower_bound(std::begin(recordfields::kRecordTypes), std::end(recordfields::kRecordTypes), rec,
+		[](const recordfields::RecordType& entry, std::string_view name) { return entry.name < name; });
+	if (recordIt == std::end(recordfields::kRecordTypes) || recordIt->name != rec) {
+		return false;
 	}
-	return exists;
+	return std::binary_search(recordIt->fields, recordIt->fields + recordIt->count, fld);
 }
 
 void Globals::unregisterArraysForInstance(InstanceDataPtr* instance) {
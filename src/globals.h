@@ -30,8 +30,26 @@ public:
         return instance;
     }
 
+    // Metadata of a base PV kept in the persistent cache file (CALAB_METADATA_CACHE).
+    struct PvMetadata {
+        short dbfType = -1;
+        uInt32 elementCount = 0;
+        std::string recordType;
+        std::vector<std::string> enumStrings;
+    };
+
     // Legacy flag to control EPICS CA polling.
     bool bCaLabPolling = false;
+    // Polling mode issues gets asynchronously and returns the previous round (CALAB_POLLING_PIPELINED).
+    bool bCaLabPollingPipelined = false;
+    // Read PREC/EGU/limits/enum strings via DBR_CTRL + DBE_PROPERTY on the base channel (CALAB_CTRL_METADATA).
+    bool bCaLabCtrlMetadata = false;
+    // Skip puts equal to the last one written while the monitor still shows it (CALAB_SUPPRESS_UNCHANGED_WRITES).
+    bool bCaLabSuppressUnchangedWrites = false;
+    // Skip any put matching the monitored value (CALAB_SUPPRESS_UNCHANGED_WRITES=monitor).
+    bool bCaLabSuppressMatchesMonitor = false;
+    // Upper limit of user events per second summed over all addEvent registrations (CALAB_MAX_EVENT_RATE, 0 = none).
+    double maxEventRate = 0.0;
     // Pointer to the debug log file.
     FILE* pCaLabDbgFile = nullptr;
 
@@ -39,18 +57,26 @@ public:
     ca_client_context* pcac = nullptr;
     // Shared mutex for general-purpose locking.
     mutable std::shared_timed_mutex getLock;
-    // Shared mutex to protect the record field cache.
-    mutable std::shared_timed_mutex fieldCacheLock;
     // Shared mutex to protect the PV registry.
     mutable std::shared_timed_mutex pvRegistryLock;
     // Registry of all known PVs, keyed by name.
     std::unordered_map<std::string, std::unique_ptr<PVItem>> pvRegistry;
+    // Shared mutex to protect the record type cache.
+    mutable std::shared_timed_mutex recordTypeCacheLock;
+    // Resolved record types of base PVs, keyed by name; outlives PVItems and reconnects.
+    std::unordered_map<std::string, std::string> recordTypeCache;
 
     // Atomic counter for the number of PVs currently in an error state.
     std::atomic<int> pvErrorCount{ 0 };
 
     // Atomic counter for the number of pending EPICS CA callbacks.
     std::atomic<int> pendingCallbacks{ 0 };
+    // Puts issued by putValue/putValueAsync and puts skipped as unchanged.
+    std::atomic<uint64_t> putsIssued{ 0 };
+    std::atomic<uint64_t> putsSuppressed{ 0 };
+    // LabVIEW user events posted and monitor updates coalesced by event rate limits.
+    std::atomic<uint64_t> eventsPosted{ 0 };
+    std::atomic<uint64_t> eventsCoalesced{ 0 };
     // List of active LabVIEW instances.
     std::vector<InstanceDataPtr*> instances{ };
     // Mutex to protect access to the instances vector
@@ -170,7 +196,7 @@ public:
     /**
      * @brief Determine if a field exists for a given EPICS record type.
      *
-     * This may consult an internal cache of record type definitions.
+     * Binary-searches the compile-time table in recordFields.h without allocating.
      *
      * @param recordTypeStr The EPICS record type as a string (e.g., "ai", "bo").
      * @param fieldName The field name without the record prefix (e.g., "EGU").
@@ -178,6 +204,75 @@ public:
      */
     bool recordFieldExists(const std::string& recordTypeStr, const std::string& fieldName);
 
+    /**
+     * @brief Check if a field is static, i.e. practically never changes at runtime.
+     *
+     * Static fields (e.g., DESC, EGU, RTYP, HOPR/LOPR) are fetched once per connection
+     * instead of being monitored.
+     *
+     * @param fieldName The field name without the record prefix (e.g., "DESC").
+     * @return true if the field is static, false if it should be monitored.
+     */
+    bool recordFieldIsStatic(const std::string& fieldName);
+
+    /**
+     * @brief Remember the record type resolved for a base PV.
+     *
+     * @param pvName The base PV name (e.g., "SIM:AI1").
+     * @param recordType The value read from the PV's .RTYP field.
+     */
+    void cacheRecordType(const std::string& pvName, const std::string& recordType);
+
+    /**
+     * @brief Look up a previously resolved record type.
+     *
+     * Lets connectPv skip the .RTYP channel for PVs seen before in this process.
+     *
+     * @param pvName The base PV name.
+     * @param recordType Receives the cached record type on success.
+     * @param unverified Optional; set if the type still has to be confirmed by an .RTYP read.
+     * @return true if the record type is known, false otherwise.
+     */
+    bool cachedRecordType(const std::string& pvName, std::string& recordType, bool* unverified = nullptr) const;
+
+    /**
+     * @brief Keep serving a cached record type, but have connectPv confirm it via .RTYP again.
+     *
+     * Used when a channel reconnects, since the IOC may have been reloaded with a new database.
+     *
+     * @param pvName The base PV name.
+     */
+    void markRecordTypeUnverified(const std::string& pvName);
+
+    /**
+     * @brief Pre-populate a freshly created base PVItem from the persistent metadata cache.
+     *
+     * Seeds native type, element count and enum labels so outputs can be sized before
+     * the channel connects. No-op unless CALAB_METADATA_CACHE is set.
+     *
+     * @param item The new PVItem; must not be connected yet.
+     */
+    void seedFromMetadataCache(PVItem* item);
+
+    /**
+     * @brief Record the native type and element count reported by CA for a base PV.
+     *
+     * Marks the cache dirty only if the values differ from the stored ones.
+     */
+    void updatePvMetadata(const std::string& pvName, short dbfType, uInt32 elementCount);
+
+    /**
+     * @brief Record the enum labels reported by CA for a base PV.
+     */
+    void updatePvEnumStrings(const std::string& pvName, const std::vector<std::string>& enumStrings);
+
+    /**
+     * @brief Write the persistent metadata cache if it changed since the last write.
+     *
+     * Called every 5 s by the metadata cache writer thread and once during shutdown.
+     */
+    void flushMetadataCache();
+
     void unregisterArraysForInstance(InstanceDataPtr* instance);
 
     /**
@@ -238,6 +333,29 @@ private:
     // Deferred PV event names for later posting.
     mutable std::mutex deferredEventsMutex_;
     std::unordered_set<std::string> deferredEvents_;
+
+    // Reads the persistent metadata cache file into metadataCache_ and recordTypeCache.
+    void loadMetadataCache();
+    // Starts the thread that writes the metadata cache file, keeping file I/O off the CA poll thread.
+    void startMetadataWriter();
+    void stopMetadataWriter();
+
+    // Path of the persistent metadata cache file; empty if the cache is disabled.
+    std::string metadataCachePath_;
+    // Mutex for the persistent metadata cache (leaf lock).
+    mutable std::mutex metadataCacheMutex_;
+    // Persistent metadata of base PVs, keyed by name.
+    std::unordered_map<std::string, PvMetadata> metadataCache_;
+    // Set when metadataCache_ differs from the file on disk.
+    bool metadataCacheDirty_ = false;
+    // Metadata cache writer thread and its stop signal (guarded by metadataWriterMutex_).
+    std::thread metadataWriter_;
+    std::mutex metadataWriterMutex_;
+    std::condition_variable metadataWriterCv_;
+    bool metadataWriterStop_ = false;
+    // Record types loaded from disk or kept across a reconnect that have not been confirmed by an .RTYP read yet;
+    // guarded by recordTypeCacheLock.
+    std::unordered_set<std::string> unverifiedRecordTypes_;
 };
 
 //==================================================================================================
@@ -0,0 +1,152 @@
+// numericParse.h
+// Parsing of numeric strings written to numeric channels (putValue with DT_STRING).
+// Header-only so tools/bench_parse_numeric.cpp can measure it without LabVIEW or EPICS.
+#pragma once
+
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <locale.h>
+#include <string>
+#include <system_error>
+
+namespace numericparse {
+
+// Decimal separator of numeric put strings, decided once per call. It only resolves strings
+// with a single separator kind that also forms valid thousands groups ("1,234" with Dot,
+// "1.234" with Comma); everything else is interpreted per element.
+enum class DecimalSeparator { Dot, Comma };
+
+// The first string containing a comma decides: a dot after its last comma means Dot,
+// otherwise the comma is the decimal separator. Without any comma the policy is Dot.
+template <typename TextAt>
+DecimalSeparator detectDecimalSeparator(TextAt textAt, uint32_t count) {
+	const char* text = nullptr;
+	size_t len = 0;
+	for (uint32_t j = 0; j < count; ++j) {
+		textAt(j, text, len);
+		size_t k = len;
+		while (k > 0 && text[k - 1] != ',') --k;
+		if (k == 0) continue;
+		return memchr(text + k, '.', len - k) ? DecimalSeparator::Dot : DecimalSeparator::Comma;
+	}
+	return DecimalSeparator::Dot;
+}
+
+// True if [first, last) is an optionally signed integer with `grouping` between valid
+// thousands groups: 1-3 leading digits followed only by groups of exactly 3 digits.
+inline bool isGroupedInteger(const char* first, const char* last, char grouping) {
+	if (first < last && (*first == '+' || *first == '-')) ++first;
+	size_t digits = 0;
+	bool grouped = false;
+	for (const char* c = first; c < last; ++c) {
+		if (*c == grouping) {
+			if (digits == 0 || digits > 3 || (grouped && digits != 3)) return false;
+			grouped = true;
+			digits = 0;
+		}
+		else if (std::isdigit(static_cast<unsigned char>(*c))) {
+			++digits;
+		}
+		else {
+			return false;
+		}
+	}
+	return grouped && digits == 3;
+}
+
+// strtod in the "C" locale; needs a NUL-terminated string. Also takes what from_chars
+// rejects (hex floats, out-of-range values).
+inline bool parseClassic(const char* start, double& value) {
+	char* end = nullptr;
+#if defined _WIN32 || defined _WIN64
+	static _locale_t cLocale = _create_locale(LC_NUMERIC, "C");
+	value = _strtod_l(start, &end, cLocale);
+#else
+	static locale_t cLocale = newlocale(LC_NUMERIC_MASK, "C", nullptr);
+	if (cLocale) {
+		value = strtod_l(start, &end, cLocale);
+	}
+	else {
+		value = std::strtod(start, &end);
+	}
+#endif
+	if (start == end) return false;
+	while (*end && std::isspace(static_cast<unsigned char>(*end))) { ++end; }
+	return (*end == '\0');
+}
+
+// Parses one numeric put string. A dot or comma is dropped only where it separates valid
+// thousands groups; otherwise a single separator is the decimal point ("1.5", "2,5") and
+// with both kinds the last one is ("1,234.5", "1.234,5"). Other combinations are rejected.
+// Only strings that need rewriting are copied (into `buffer`); everything else is parsed in
+// place with std::from_chars where the standard library provides it.
+inline bool parseNumericString(const char* text, size_t len, DecimalSeparator sep, std::string& buffer, double& out) {
+	const char* first = text;
+	const char* last = text + len;
+	while (first < last && std::isspace(static_cast<unsigned char>(*first))) ++first;
+	while (last > first && std::isspace(static_cast<unsigned char>(last[-1]))) --last;
+	if (first == last) return false;
+
+	const char* lastComma = nullptr;
+	const char* lastDot = nullptr;
+	size_t commas = 0;
+	size_t dots = 0;
+	for (const char* c = first; c < last; ++c) {
+		if (*c == ',') { lastComma = c; ++commas; }
+		else if (*c == '.') { lastDot = c; ++dots; }
+	}
+
+	char decimal = '.';
+	char grouping = '\0';
+	if (commas && dots) {
+		// The last separator is the decimal point; the other must group the integer part.
+		const char* decimalPos = (lastComma > lastDot) ? lastComma : lastDot;
+		decimal = *decimalPos;
+		grouping = (decimal == ',') ? '.' : ',';
+		if ((decimal == ',' ? commas : dots) != 1 || !isGroupedInteger(first, decimalPos, grouping)) {
+			return false;
+		}
+	}
+	else if (commas || dots) {
+		const char only = commas ? ',' : '.';
+		const char policyGrouping = (sep == DecimalSeparator::Comma) ? '.' : ',';
+		const char* mantissaEnd = first;
+		while (mantissaEnd < last && *mantissaEnd != 'e' && *mantissaEnd != 'E') ++mantissaEnd;
+		if (only == policyGrouping && isGroupedInteger(first, mantissaEnd, only)) {
+			grouping = only;
+		}
+		else if ((commas ? commas : dots) == 1) {
+			decimal = only;
+		}
+		else {
+			return false;
+		}
+	}
+
+	const bool rewrite = grouping != '\0' || decimal != '.';
+	if (rewrite) {
+		buffer.clear();
+		for (const char* c = first; c < last; ++c) {
+			if (*c == grouping) continue;
+			buffer.push_back(*c == decimal ? '.' : *c);
+		}
+		first = buffer.data();
+		last = first + buffer.size();
+	}
+#if defined(__cpp_lib_to_chars)
+	const char* digits = (*first == '+' && last - first > 1 && first[1] != '-') ? first + 1 : first;
+	const std::from_chars_result res = std::from_chars(digits, last, out);
+	if (res.ec == std::errc() && res.ptr == last) {
+		return true;
+	}
+#endif
+	if (!rewrite) {
+		buffer.assign(first, last);
+	}
+	return parseClassic(buffer.c_str(), out);
+}
+
+} // namespace numericparse
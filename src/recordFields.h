@@ -0,0 +1,224 @@
+// recordFields.h
+// Generated by tools/gen_record_fields.py - do not edit by hand.
+// Record-specific fields based on the EPICS dbd files from epics-base and
+// the sscan, motor and std modules. All arrays are sorted for binary search.
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace recordfields {
+
+struct RecordType {
+	std::string_view name;
+	const std::string_view* fields;
+	std::size_t count;
+};
+
+inline constexpr std::string_view kCommonFields[] = {
+	"ACKS", "ACKT", "ASG", "BKPT", "DESC", "DISA", "DISP", "DISS", "DISV",
+	"DTYP", "EVNT", "FLNK", "LCNT", "MLIS", "MLOK", "NAME", "NSEV", "NSTA",
+	"PACT", "PHAS", "PINI", "PRIO", "PROC", "PUTF", "RPRO", "RTYP", "SCAN",
+	"SDIS", "SEVR", "STAT", "TIME", "TPRO", "TSE", "TSEL", "UDF", "UDFS",
+	"VAL"
+};
+
+inline constexpr std::string_view kFields_aai[] = {
+	"BPTR", "EGU", "FTVL", "HHSV", "HIGH", "HIHI", "HOPR", "HSV", "HYST",
+	"INP", "LLSV", "LOLO", "LOPR", "LOW", "LSV", "MDEL", "NELM", "NORD",
+	"PREC", "SIML", "SIMS", "SIOL", "SVAL"
+};
+inline constexpr std::string_view kFields_aao[] = {
+	"BPTR", "DOL", "EGU", "FTVL", "HHSV", "HIGH", "HIHI", "HOPR", "HSV",
+	"HYST", "IVOA", "IVOV", "LLSV", "LOLO", "LOPR", "LOW", "LSV", "MDEL",
+	"NELM", "NORD", "OMSL", "OUT", "PREC", "SIML", "SIMS", "SIOL", "SVAL"
+};
+inline constexpr std::string_view kFields_ai[] = {
+	"ADEL", "AOFF", "ASLO", "EGU", "EGUF", "EGUL", "HHSV", "HIGH", "HIHI",
+	"HOPR", "HSV", "HYST", "INP", "LINR", "LLSV", "LOLO", "LOPR", "LOW",
+	"LSV", "MDEL", "PREC", "RVAL", "SIML", "SIMS", "SIOL", "SMOO", "SVAL"
+};
+inline constexpr std::string_view kFields_ao[] = {
+	"ADEL", "DOL", "DRVH", "DRVL", "EGU", "EGUF", "EGUL", "HHSV", "HIGH",
+	"HIHI", "HOPR", "HSV", "HYST", "INIT", "IVOA", "IVOV", "LBRK", "LINR",
+	"LLSV", "LOLO", "LOPR", "LOW", "LSV", "MDEL", "OIF", "OMSL", "ORAW",
+	"ORBV", "OUT", "PBRK", "PREC", "RBV", "RVAL", "SIML", "SIMS", "SIOL",
+	"SVAL"
+};
+inline constexpr std::string_view kFields_bi[] = {
+	"COSV", "INP", "MASK", "ONAM", "OSV", "RVAL", "SIML", "SIMS", "SIOL",
+	"SVAL", "ZNAM", "ZSV"
+};
+inline constexpr std::string_view kFields_bo[] = {
+	"COSV", "DOL", "HIGH", "IVOA", "IVOV", "MASK", "OMSL", "ONAM", "OSV",
+	"OUT", "RBV", "RVAL", "SIML", "SIMS", "SIOL", "SVAL", "ZNAM", "ZSV"
+};
+inline constexpr std::string_view kFields_busy[] = {
+	"INP", "ONAM", "OUT", "ZNAM"
+};
+inline constexpr std::string_view kFields_calc[] = {
+	"A", "AA", "ADEL", "B", "BB", "C", "CALC", "CC", "D",
+	"DD", "DLYA", "DOPT", "E", "EE", "EGU", "F", "FF", "G",
+	"GG", "H", "HH", "HHSV", "HIGH", "HIHI", "HOPR", "HSV", "HYST",
+	"I", "II", "INPA", "INPB", "INPC", "INPD", "INPE", "INPF", "INPG",
+	"INPH", "INPI", "INPJ", "INPK", "INPL", "J", "JJ", "K", "KK",
+	"L", "LL", "LLSV", "LOLO", "LOPR", "LOW", "LSV", "MDEL", "OCAL",
+	"ODLY", "OOPT", "OVAL", "PREC", "WAIT"
+};
+inline constexpr std::string_view kFields_calcout[] = {
+	"CALC", "DLYA", "DOL", "DOPT", "EGU", "HHSV", "HIGH", "HIHI", "HOPR",
+	"HSV", "INPA", "INPB", "INPC", "INPD", "INPE", "INPF", "INPG", "INPH",
+	"INPI", "INPJ", "INPK", "INPL", "IVOA", "IVOV", "LLSV", "LOLO", "LOPR",
+	"LOW", "LSV", "OCAL", "OOPT", "OUT", "OVAL", "PREC", "WAIT"
+};
+inline constexpr std::string_view kFields_compress[] = {
+	"ALG", "CVT", "HHSV", "HIGH", "HIHI", "HOPR", "HSV", "INP", "LLSV",
+	"LOLO", "LOPR", "LOW", "LSV", "NSAM", "NUSE", "OFF", "RES", "SQUE"
+};
+inline constexpr std::string_view kFields_dfanout[] = {
+	"INP", "OUTA", "OUTB", "OUTC", "OUTD", "OUTE", "OUTF", "OUTG", "OUTH",
+	"SELL", "SELM"
+};
+inline constexpr std::string_view kFields_event[] = {
+	"INP", "OVAL", "SIML", "SIMS", "SIOL", "SVAL"
+};
+inline constexpr std::string_view kFields_fanout[] = {
+	"INP", "LNK0", "LNK1", "LNK2", "LNK3", "LNK4", "LNK5", "LNK6", "LNK7",
+	"LNK8", "LNK9", "LNKA", "LNKB", "LNKC", "LNKD", "LNKE", "LNKF", "SELL",
+	"SELM"
+};
+inline constexpr std::string_view kFields_longin[] = {
+	"EGU", "HHSV", "HIGH", "HIHI", "HOPR", "HSV", "HYST", "INP", "LLSV",
+	"LOLO", "LOPR", "LOW", "LSV", "MDEL", "SIML", "SIMS", "SIOL", "SVAL"
+};
+inline constexpr std::string_view kFields_longout[] = {
+	"DOL", "DRVH", "DRVL", "EGU", "HHSV", "HIGH", "HIHI", "HOPR", "HSV",
+	"IVOA", "IVOV", "LLSV", "LOLO", "LOPR", "LOW", "LSV", "OMSL", "OUT"
+};
+inline constexpr std::string_view kFields_mbbi[] = {
+	"COSV", "EIST", "EISV", "EIVL", "ELST", "ELSV", "ELVL", "FFST", "FFSV",
+	"FFVL", "FRST", "FRSV", "FRVL", "FTST", "FTSV", "FTVL", "FVST", "FVSV",
+	"FVVL", "INP", "MASK", "NIST", "NISV", "NIVL", "NOBT", "ONST", "ONSV",
+	"ONVL", "RVAL", "SHFT", "SIML", "SIMS", "SIOL", "SVAL", "SVST", "SVSV",
+	"SVVL", "SXST", "SXSV", "SXVL", "TEST", "TESV", "TEVL", "THST", "THSV",
+	"THVL", "TTST", "TTSV", "TTVL", "TVST", "TVSV", "TVVL", "TWST", "TWSV",
+	"TWVL", "ZRST", "ZRSV", "ZRVL"
+};
+inline constexpr std::string_view kFields_mbbo[] = {
+	"COSV", "DOL", "EIST", "EISV", "EIVL", "ELST", "ELSV", "ELVL", "FFST",
+	"FFSV", "FFVL", "FRST", "FRSV", "FRVL", "FTST", "FTSV", "FTVL", "FVST",
+	"FVSV", "FVVL", "IVOA", "IVOV", "MASK", "NIST", "NISV", "NIVL", "NOBT",
+	"OMSL", "ONST", "ONSV", "ONVL", "ORBV", "OUT", "RBV", "RVAL", "SHFT",
+	"SVST", "SVSV", "SVVL", "SXST", "SXSV", "SXVL", "TEST", "TESV", "TEVL",
+	"THST", "THSV", "THVL", "TTST", "TTSV", "TTVL", "TVST", "TVSV", "TVVL",
+	"TWST", "TWSV", "TWVL", "ZRST", "ZRSV", "ZRVL"
+};
+inline constexpr std::string_view kFields_motor[] = {
+	"ACCL", "ADEL", "ALST", "ATHM", "BACC", "BDST", "BVEL", "CARD", "CDIR",
+	"CNEN", "DCOF", "DHLM", "DIFF", "DINP", "DIR", "DLLM", "DLY", "DMOV",
+	"DOL", "DRBV", "DVAL", "EGU", "ERES", "FOF", "FOFF", "FRAC", "HHSV",
+	"HIGH", "HIHI", "HLM", "HLS", "HLSV", "HOME", "HOMF", "HOMR", "HOPR",
+	"HSV", "HVEL", "ICOF", "INIT", "JAR", "JOGF", "JOGR", "JVEL", "LDVL",
+	"LLM", "LLS", "LLSV", "LOCK", "LOLO", "LOPR", "LOW", "LRLV", "LRVL",
+	"LSPG", "LSV", "LVAL", "LVIO", "MDEL", "MIP", "MISS", "MLST", "MOVN",
+	"MRES", "MSTA", "NTM", "NTMF", "OFF", "OMSL", "OUT", "PCOF", "POST",
+	"PP", "PREC", "PREM", "RBV", "RCNT", "RDBD", "RDBL", "RDIF", "REP",
+	"RHLS", "RINP", "RLNK", "RLV", "RMOD", "RMP", "RRBV", "RRES", "RSTM",
+	"RTRY", "RVAL", "RVEL", "S", "SBAK", "SBAS", "SET", "SMAX", "SPDB",
+	"SPMG", "SREV", "STOO", "STOP", "STUP", "SUSE", "SYNC", "TDIR", "TWF",
+	"TWR", "TWV", "UEIP", "UREV", "URIP", "VBAS", "VELO", "VERS", "VMAX",
+	"VOF"
+};
+inline constexpr std::string_view kFields_pid[] = {
+	"CVAL", "D", "DEAD", "DGAP", "DP", "DRVH", "DRVL", "DT", "EGU",
+	"ERR", "FBON", "HIGH", "HIHI", "HOPR", "I", "INP", "IVAL", "KD",
+	"KI", "KP", "LOLO", "LOPR", "LOW", "MAXI", "MDEL", "MID", "OIF",
+	"OMSL", "OUT", "P", "PVAL", "RBV", "STN", "SUM", "TMOD", "TRIG"
+};
+inline constexpr std::string_view kFields_sscan[] = {
+	"ACQM", "ACQS", "ACQT", "AERY", "AQR", "ATIME", "AWCT", "BSPV", "BSWAIT",
+	"BUSY", "CMND", "CPT", "CTIME", "D01PV", "D02PV", "D03PV", "D04PV", "D05PV",
+	"D06PV", "D07PV", "D08PV", "D09PV", "D10PV", "D11PV", "D12PV", "D13PV", "D14PV",
+	"D15PV", "D16PV", "D17PV", "D18PV", "D19PV", "D20PV", "D21PV", "D22PV", "D23PV",
+	"D24PV", "D25PV", "D26PV", "D27PV", "D28PV", "D29PV", "D30PV", "D31PV", "D32PV",
+	"D33PV", "D34PV", "D35PV", "D36PV", "D37PV", "D38PV", "D39PV", "D40PV", "D41PV",
+	"D42PV", "D43PV", "D44PV", "D45PV", "D46PV", "D47PV", "D48PV", "D49PV", "D50PV",
+	"D51PV", "D52PV", "D53PV", "D54PV", "D55PV", "D56PV", "D57PV", "D58PV", "D59PV",
+	"D60PV", "D61PV", "D62PV", "D63PV", "D64PV", "D65PV", "D66PV", "D67PV", "D68PV",
+	"D69PV", "D70PV", "D71PV", "D72PV", "D73PV", "D74PV", "D75PV", "DATA", "DDLY",
+	"DIM", "EXSC", "FFL", "FFO", "FNAM", "FNUM", "FPTS", "MPTS", "NDATTR",
+	"NPTS", "P1AR", "P1CR", "P1CV", "P1EP", "P1HR", "P1LR", "P1LV", "P1NP",
+	"P1NV", "P1PA", "P1PV", "P1RA", "P1SI", "P1SM", "P1SP", "P1WD", "P2AR",
+	"P2CR", "P2CV", "P2EP", "P2HR", "P2LR", "P2LV", "P2NP", "P2NV", "P2PA",
+	"P2PV", "P2RA", "P2SI", "P2SM", "P2SP", "P2WD", "P3AR", "P3CR", "P3CV",
+	"P3EP", "P3HR", "P3LR", "P3LV", "P3NP", "P3NV", "P3PA", "P3PV", "P3RA",
+	"P3SI", "P3SM", "P3SP", "P3WD", "P4AR", "P4CR", "P4CV", "P4EP", "P4HR",
+	"P4LR", "P4LV", "P4NP", "P4NV", "P4PA", "P4PV", "P4RA", "P4SI", "P4SM",
+	"P4SP", "P4WD", "PAME", "PASM", "PAUS", "PDLY", "PREA", "PREC", "PTIME",
+	"R1CV", "R1NV", "R1PV", "R2CV", "R2NV", "R2PV", "R3CV", "R3NV", "R3PV",
+	"R4CV", "R4NV", "R4PV", "R5CV", "R5NV", "R5PV", "SMSG", "STIME", "STRATTR",
+	"T1CV", "T1NV", "T1PV", "T2CV", "T2NV", "T2PV", "T3CV", "T3NV", "T3PV",
+	"T4CV", "T4NV", "T4PV", "VERS", "WAIT", "WERR"
+};
+inline constexpr std::string_view kFields_sseq[] = {
+	"ABRT", "BUSY", "DLY1", "DLY2", "DLY3", "DLY4", "DLY5", "DLY6", "DLY7",
+	"DLY8", "DLY9", "DLYA", "DO1", "DO2", "DO3", "DO4", "DO5", "DO6",
+	"DO7", "DO8", "DO9", "DOA", "DOL1", "DOL2", "DOL3", "DOL4", "DOL5",
+	"DOL6", "DOL7", "DOL8", "DOL9", "DOLA", "LNK1", "LNK2", "LNK3", "LNK4",
+	"LNK5", "LNK6", "LNK7", "LNK8", "LNK9", "LNKA", "PAUS", "PREC", "SELL",
+	"SELM", "STR1", "STR2", "STR3", "STR4", "STR5", "STR6", "STR7", "STR8",
+	"STR9", "STRA", "VERS"
+};
+inline constexpr std::string_view kFields_stringin[] = {
+	"INP", "OVAL", "SIML", "SIMS", "SIOL", "SVAL"
+};
+inline constexpr std::string_view kFields_stringout[] = {
+	"DOL", "IVOA", "IVOV", "OMSL", "OUT", "OVAL", "SIML", "SIMS", "SIOL",
+	"SVAL"
+};
+inline constexpr std::string_view kFields_sub[] = {
+	"BRSV", "INAM", "INPA", "INPB", "INPC", "INPD", "INPE", "INPF", "INPG",
+	"INPH", "INPI", "INPJ", "INPK", "INPL", "LFLG", "LNAM", "OUTA", "OUTB",
+	"OUTC", "OUTD", "OUTE", "OUTF", "OUTG", "OUTH", "OUTI", "OUTJ", "OUTK",
+	"OUTL", "SNAM", "SUBL", "SUBM"
+};
+inline constexpr std::string_view kFields_subarray[] = {
+	"BPTR", "EGU", "FTVL", "INDX", "INP", "LENG", "MALM", "NELM", "NORD",
+	"OUT", "PREC", "SUBL"
+};
+inline constexpr std::string_view kFields_waveform[] = {
+	"BPTR", "EGU", "FTVL", "HHSV", "HIGH", "HIHI", "HOPR", "HSV", "HYST",
+	"INP", "LLSV", "LOLO", "LOPR", "LOW", "LSV", "NELM", "NORD", "PREC",
+	"RARM", "RMOD", "SIML", "SIMS", "SIOL", "SVAL"
+};
+
+inline constexpr RecordType kRecordTypes[] = {
+	{ "aai", kFields_aai, sizeof(kFields_aai) / sizeof(kFields_aai[0]) },
+	{ "aao", kFields_aao, sizeof(kFields_aao) / sizeof(kFields_aao[0]) },
+	{ "ai", kFields_ai, sizeof(kFields_ai) / sizeof(kFields_ai[0]) },
+	{ "ao", kFields_ao, sizeof(kFields_ao) / sizeof(kFields_ao[0]) },
+	{ "bi", kFields_bi, sizeof(kFields_bi) / sizeof(kFields_bi[0]) },
+	{ "bo", kFields_bo, sizeof(kFields_bo) / sizeof(kFields_bo[0]) },
+	{ "busy", kFields_busy, sizeof(kFields_busy) / sizeof(kFields_busy[0]) },
+	{ "calc", kFields_calc, sizeof(kFields_calc) / sizeof(kFields_calc[0]) },
+	{ "calcout", kFields_calcout, sizeof(kFields_calcout) / sizeof(kFields_calcout[0]) },
+	{ "compress", kFields_compress, sizeof(kFields_compress) / sizeof(kFields_compress[0]) },
+	{ "dfanout", kFields_dfanout, sizeof(kFields_dfanout) / sizeof(kFields_dfanout[0]) },
+	{ "event", kFields_event, sizeof(kFields_event) / sizeof(kFields_event[0]) },
+	{ "fanout", kFields_fanout, sizeof(kFields_fanout) / sizeof(kFields_fanout[0]) },
+	{ "longin", kFields_longin, sizeof(kFields_longin) / sizeof(kFields_longin[0]) },
+	{ "longout", kFields_longout, sizeof(kFields_longout) / sizeof(kFields_longout[0]) },
+	{ "mbbi", kFields_mbbi, sizeof(kFields_mbbi) / sizeof(kFields_mbbi[0]) },
+	{ "mbbo", kFields_mbbo, sizeof(kFields_mbbo) / sizeof(kFields_mbbo[0]) },
+	{ "motor", kFields_motor, sizeof(kFields_motor) / sizeof(kFields_motor[0]) },
+	{ "pid", kFields_pid, sizeof(kFields_pid) / sizeof(kFields_pid[0]) },
+	{ "sscan", kFields_sscan, sizeof(kFields_sscan) / sizeof(kFields_sscan[0]) },
+	{ "sseq", kFields_sseq, sizeof(kFields_sseq) / sizeof(kFields_sseq[0]) },
+	{ "stringin", kFields_stringin, sizeof(kFields_stringin) / sizeof(kFields_stringin[0]) },
+	{ "stringout", kFields_stringout, sizeof(kFields_stringout) / sizeof(kFields_stringout[0]) },
+	{ "sub", kFields_sub, sizeof(kFields_sub) / sizeof(kFields_sub[0]) },
+	{ "subarray", kFields_subarray, sizeof(kFields_subarray) / sizeof(kFields_subarray[0]) },
+	{ "waveform", kFields_waveform, sizeof(kFields_waveform) / sizeof(kFields_waveform[0]) }
+};
+
+} // namespace recordfields
@@ -0,0 +1,140 @@
+// bench_parse_numeric.cpp
+// Benchmark of the numeric put string parser (src/numericParse.h) against the previous
+// strtod_l-first parser, for a large string array written into a DBF_DOUBLE waveform.
+// Needs neither LabVIEW nor EPICS:
+//
+//     g++ -O2 -std=c++17 -Isrc tools/bench_parse_numeric.cpp -o bench_parse_numeric
+//     ./bench_parse_numeric [elements] [rounds]
+//
+// Defaults: 1000000 elements, 10 rounds. Four inputs are measured: plain "1234.5678",
+// comma decimals "1234,5678", grouped "1,234.5678" and a mix of all three. Every round
+// parses the whole array, like one putValue call; the best round is reported.
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "numericParse.h"
+
+namespace {
+
+// The parser before numericParse.h: strtod_l on a std::string, then a normalized copy.
+bool legacyParse(const std::string& txt, double& out) {
+	auto parseClassic = [](const std::string& s, double& value) -> bool {
+		return numericparse::parseClassic(s.c_str(), value);
+	};
+	if (parseClassic(txt, out)) return true;
+	size_t lastComma = std::string::npos;
+	size_t lastDot = std::string::npos;
+	for (size_t i = 0; i < txt.size(); ++i) {
+		if (txt[i] == ',') lastComma = i;
+		else if (txt[i] == '.') lastDot = i;
+	}
+	const bool hasComma = (lastComma != std::string::npos);
+	const bool hasDot = (lastDot != std::string::npos);
+	if (!hasComma) return false;
+	char decimal = ',';
+	char thousands = '\0';
+	if (hasComma && hasDot) {
+		if (lastComma > lastDot) { decimal = ','; thousands = '.'; }
+		else { decimal = '.'; thousands = ','; }
+	}
+	std::string normalized;
+	normalized.reserve(txt.size());
+	for (char c : txt) {
+		if (thousands && c == thousands) continue;
+		normalized.push_back(c == decimal ? '.' : c);
+	}
+	if (normalized == txt) return false;
+	return parseClassic(normalized, out);
+}
+
+enum class Style { Dot, Comma, Grouped, Mixed };
+
+std::vector<std::string> makeInput(size_t n, Style style) {
+	std::mt19937 rng(12345);
+	std::uniform_real_distribution<double> dist(-1.0e6, 1.0e6);
+	std::vector<std::string> out;
+	out.reserve(n);
+	char buf[64];
+	for (size_t i = 0; i < n; ++i) {
+		const double v = dist(rng);
+		Style s = style;
+		if (s == Style::Mixed) s = static_cast<Style>(i % 3);
+		if (s == Style::Grouped) {
+			const long long whole = static_cast<long long>(std::abs(v));
+			const int frac = static_cast<int>((std::abs(v) - static_cast<double>(whole)) * 10000.0);
+			if (whole >= 1000) {
+				std::snprintf(buf, sizeof(buf), "%s%lld,%03lld.%04d", v < 0 ? "-" : "", whole / 1000, whole % 1000, frac);
+			}
+			else {
+				std::snprintf(buf, sizeof(buf), "%s%lld.%04d", v < 0 ? "-" : "", whole, frac);
+			}
+		}
+		else {
+			std::snprintf(buf, sizeof(buf), "%.4f", v);
+			if (s == Style::Comma) {
+				for (char* c = buf; *c; ++c) if (*c == '.') *c = ',';
+			}
+		}
+		out.emplace_back(buf);
+	}
+	return out;
+}
+
+template <typename Fn>
+double bestRoundMs(int rounds, Fn&& fn) {
+	double best = 1e300;
+	for (int r = 0; r < rounds; ++r) {
+		const auto t0 = std::chrono::steady_clock::now();
+		fn();
+		const auto t1 = std::chrono::steady_clock::now();
+		best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+	}
+	return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const size_t n = (argc > 1) ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+	const int rounds = (argc > 2) ? std::atoi(argv[2]) : 10;
+	const struct { const char* name; Style style; } cases[] = {
+		{ "dot", Style::Dot }, { "comma", Style::Comma }, { "grouped", Style::Grouped }, { "mixed", Style::Mixed },
+	};
+
+	std::printf("%-8s %12s %12s %9s %10s\n", "input", "legacy ms", "current ms", "speedup", "mismatch");
+	for (const auto& c : cases) {
+		const std::vector<std::string> input = makeInput(n, c.style);
+		std::vector<double> legacy(n), current(n);
+
+		const double legacyMs = bestRoundMs(rounds, [&] {
+			for (size_t j = 0; j < n; ++j) {
+				if (!legacyParse(input[j], legacy[j])) legacy[j] = 0.0;
+			}
+		});
+		const double currentMs = bestRoundMs(rounds, [&] {
+			// One call: detect the separator once, then parse every element.
+			auto textAt = [&](uint32_t j, const char*& text, size_t& len) {
+				text = input[j].data();
+				len = input[j].size();
+			};
+			std::string buffer;
+			const numericparse::DecimalSeparator sep = numericparse::detectDecimalSeparator(textAt, static_cast<uint32_t>(n));
+			for (size_t j = 0; j < n; ++j) {
+				if (!numericparse::parseNumericString(input[j].data(), input[j].size(), sep, buffer, current[j])) current[j] = 0.0;
+			}
+		});
+
+		size_t mismatches = 0;
+		for (size_t j = 0; j < n; ++j) {
+			if (legacy[j] != current[j]) ++mismatches;
+		}
+		std::printf("%-8s %12.2f %12.2f %8.2fx %10zu\n", c.name, legacyMs, currentMs, legacyMs / currentMs, mismatches);
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Generate src/recordFields.h, the compile-time EPICS record field table.
+
+The table is a set of sorted std::string_view arrays that Globals::recordFieldExists
+binary-searches without allocating. Record types are read from EPICS database
+definition files (*.dbd):
+
+    recordtype(ai) {
+        include "dbCommon.dbd"
+        field(VAL,DBF_DOUBLE) { ... }
+        ...
+    }
+
+Fields pulled in through dbCommon.dbd are not expanded; they are covered by the
+common field list. Pass --merge to keep the record types of an existing header
+and add/replace the ones found in the given dbd files:
+
+    python3 tools/gen_record_fields.py --merge src/recordFields.h \
+        $EPICS_BASE/dbd/*Record.dbd $SSCAN/dbd/sscanRecord.dbd > recordFields.h.new
+"""
+
+import argparse
+import re
+import sys
+
+# Fields that exist in every record (dbCommon.dbd).
+COMMON_FIELDS = [
+    "NAME", "DESC", "ASG", "SCAN", "PINI", "PHAS", "EVNT", "TSE", "TSEL", "DTYP",
+    "DISV", "DISA", "SDIS", "MLOK", "MLIS", "DISP", "PROC", "STAT", "SEVR", "NSTA",
+    "NSEV", "ACKS", "ACKT", "DISS", "LCNT", "PACT", "PUTF", "RPRO", "PRIO", "TPRO",
+    "BKPT", "UDF", "UDFS", "TIME", "FLNK", "RTYP", "VAL",
+]
+
+RECORDTYPE_RE = re.compile(r"\brecordtype\s*\(\s*([A-Za-z0-9_]+)\s*\)\s*\{")
+FIELD_RE = re.compile(r"\bfield\s*\(\s*([A-Za-z0-9_]+)\s*,")
+HEADER_ARRAY_RE = re.compile(r"kFields_([A-Za-z0-9_]+)\[\]\s*=\s*\{([^}]*)\}")
+HEADER_NAME_RE = re.compile(r'"([^"]*)"')
+
+
+def strip_comments(text):
+    return "\n".join(line.split("#", 1)[0] for line in text.splitlines())
+
+
+def record_body(text, start):
+    """Return the text between the brace at text[start - 1] and its match."""
+    depth = 1
+    pos = start
+    while pos < len(text) and depth > 0:
+        if text[pos] == "{":
+            depth += 1
+        elif text[pos] == "}":
+            depth -= 1
+        pos += 1
+    return text[start:pos - 1]
+
+
+def parse_dbd(path, table):
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = strip_comments(f.read())
+    for m in RECORDTYPE_RE.finditer(text):
+        fields = set(FIELD_RE.findall(record_body(text, m.end())))
+        table[m.group(1).lower()] = fields
+
+
+def parse_header(path, table):
+    with open(path, encoding="utf-8-sig") as f:
+        text = f.read()
+    for m in HEADER_ARRAY_RE.finditer(text):
+        table[m.group(1)] = set(HEADER_NAME_RE.findall(m.group(2)))
+
+
+def emit_list(names, indent="\t", per_line=9):
+    lines = []
+    for i in range(0, len(names), per_line):
+        lines.append(indent + ", ".join('"%s"' % n for n in names[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def emit(table, out):
+    common = sorted(set(COMMON_FIELDS))
+    out.write("// recordFields.h\n")
+    out.write("// Generated by tools/gen_record_fields.py - do not edit by hand.\n")
+    out.write("// Record-specific fields based on the EPICS dbd files from epics-base and\n")
+    out.write("// the sscan, motor and std modules. All arrays are sorted for binary search.\n")
+    out.write("#pragma once\n\n#include <cstddef>\n#include <string_view>\n\n")
+    out.write("namespace recordfields {\n\n")
+    out.write("struct RecordType {\n")
+    out.write("\tstd::string_view name;\n")
+    out.write("\tconst std::string_view* fields;\n")
+    out.write("\tstd::size_t count;\n")
+    out.write("};\n\n")
+    out.write("inline constexpr std::string_view kCommonFields[] = {\n")
+    out.write(emit_list(common) + "\n};\n\n")
+    for rec in sorted(table):
+        fields = sorted(table[rec] - set(common))
+        if not fields:
+            continue
+        out.write("inline constexpr std::string_view kFields_%s[] = {\n" % rec)
+        out.write(emit_list(fields) + "\n};\n")
+    out.write("\ninline constexpr RecordType kRecordTypes[] = {\n")
+    entries = []
+    for rec in sorted(table):
+        if table[rec] - set(common):
+            entries.append('\t{ "%s", kFields_%s, sizeof(kFields_%s) / sizeof(kFields_%s[0]) }'
+                           % (rec, rec, rec, rec))
+    out.write(",\n".join(entries) + "\n};\n\n")
+    out.write("} // namespace recordfields\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dbd", nargs="*", help="EPICS database definition files")
+    parser.add_argument("--merge", metavar="HEADER",
+                        help="existing recordFields.h whose record types are kept")
+    parser.add_argument("-o", "--output", help="output file (default: stdout)")
+    args = parser.parse_args()
+
+    table = {}
+    if args.merge:
+        parse_header(args.merge, table)
+    for path in args.dbd:
+        parse_dbd(path, table)
+    if not table:
+        parser.error("no record types found")
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8", newline="\n") as out:
+            emit(table, out)
+    else:
+        emit(table, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()